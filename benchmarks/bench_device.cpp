@@ -0,0 +1,150 @@
+#include <functional>
+#include <type_traits>
+
+#include <sycl/sycl.hpp>
+
+#include "sycl_ext_complex.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_common.h"
+using namespace benchmark_common;
+
+enum class Algorithm { REDUCE, INCLUSIVE_SCAN, DOTC, NRM2, IAMAX };
+
+template <typename R> class BenchmarkData {
+public:
+  BenchmarkData(std::size_t max_n)
+      : q_(sycl::default_selector_v), max_n_(max_n) {
+    R *h_random_data = sycl::malloc_host<R>(max_n * 2, q_);
+
+    d_a_ = sycl::malloc_device<R>(max_n * 2, q_);
+    d_c_ = sycl::malloc_device<R>(max_n * 2, q_);
+
+    fill_random(h_random_data, max_n * 2);
+    q_.copy(h_random_data, d_a_, 2 * max_n);
+    q_.wait();
+
+    sycl::free(h_random_data, q_);
+  }
+
+  ~BenchmarkData() {
+    sycl::free(d_a_, q_);
+    sycl::free(d_c_, q_);
+  }
+
+  template <typename T> T *get_device_input(std::size_t n) {
+    assert(n <= max_n_);
+    return reinterpret_cast<T *>(d_a_);
+  }
+
+  template <typename T> T *get_device_output(std::size_t n) {
+    assert(n <= max_n_);
+    return reinterpret_cast<T *>(d_c_);
+  }
+
+  sycl::queue &get_queue() { return q_; }
+
+private:
+  sycl::queue q_;
+  std::size_t max_n_;
+  R *d_a_;
+  R *d_c_;
+};
+
+// Size of each vector is N_MAX * 16 bytes for complex double,
+// so with two vectors, that is 256M * 16 * 2 = 8 GB.
+constexpr int N_MIN = 1024;
+constexpr int N_MAX = 256 * 1024 * 1024;
+
+template <typename R> auto get_benchmark_data() {
+  static BenchmarkData<R> *data = nullptr;
+  if (data == nullptr) {
+    data = new BenchmarkData<R>(N_MAX);
+  }
+  return data;
+}
+
+template <typename R, Algorithm algorithm>
+static void BM_device_algorithm(benchmark::State &state) {
+  using T = sycl::ext::cplx::complex<R>;
+
+  std::size_t n = state.range(0);
+
+  auto bench_data = get_benchmark_data<R>();
+
+  auto a = bench_data->template get_device_input<T>(n);
+  auto c = bench_data->template get_device_output<T>(n);
+
+  sycl::queue &Q = bench_data->get_queue();
+
+  for (auto _ : state) {
+    if constexpr (algorithm == Algorithm::REDUCE)
+      benchmark::DoNotOptimize(
+          sycl::ext::cplx::reduce(Q, a, n, sycl::plus<>()));
+    else if constexpr (algorithm == Algorithm::DOTC)
+      benchmark::DoNotOptimize(sycl::ext::cplx::dotc(Q, a, a + n, n));
+    else if constexpr (algorithm == Algorithm::NRM2)
+      benchmark::DoNotOptimize(sycl::ext::cplx::nrm2(Q, a, n));
+    else if constexpr (algorithm == Algorithm::IAMAX)
+      benchmark::DoNotOptimize(sycl::ext::cplx::iamax(Q, a, n));
+    else
+      sycl::ext::cplx::inclusive_scan(Q, a, c, n, sycl::plus<>());
+  }
+
+  // Number of arrays read or written
+  constexpr std::size_t arrays =
+      algorithm == Algorithm::REDUCE || algorithm == Algorithm::NRM2 ||
+              algorithm == Algorithm::IAMAX
+          ? 1
+          : 2;
+
+  state.SetBytesProcessed(state.iterations() * n * sizeof(T) * arrays);
+}
+
+BENCHMARK(BM_device_algorithm<float, Algorithm::REDUCE>)
+    ->RangeMultiplier(8)
+    ->Range(N_MIN, N_MAX)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_device_algorithm<double, Algorithm::REDUCE>)
+    ->RangeMultiplier(8)
+    ->Range(N_MIN, N_MAX)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_device_algorithm<float, Algorithm::INCLUSIVE_SCAN>)
+    ->RangeMultiplier(8)
+    ->Range(N_MIN, N_MAX)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_device_algorithm<double, Algorithm::INCLUSIVE_SCAN>)
+    ->RangeMultiplier(8)
+    ->Range(N_MIN, N_MAX)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_device_algorithm<float, Algorithm::DOTC>)
+    ->RangeMultiplier(8)
+    ->Range(N_MIN, N_MAX)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_device_algorithm<double, Algorithm::DOTC>)
+    ->RangeMultiplier(8)
+    ->Range(N_MIN, N_MAX)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_device_algorithm<float, Algorithm::NRM2>)
+    ->RangeMultiplier(8)
+    ->Range(N_MIN, N_MAX)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_device_algorithm<double, Algorithm::NRM2>)
+    ->RangeMultiplier(8)
+    ->Range(N_MIN, N_MAX)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_device_algorithm<float, Algorithm::IAMAX>)
+    ->RangeMultiplier(8)
+    ->Range(N_MIN, N_MAX)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_device_algorithm<double, Algorithm::IAMAX>)
+    ->RangeMultiplier(8)
+    ->Range(N_MIN, N_MAX)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
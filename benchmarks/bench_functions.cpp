@@ -1,7 +1,10 @@
+#include <algorithm>
 #include <cmath>
 #include <complex>
 #include <functional>
+#include <limits>
 #include <type_traits>
+#include <vector>
 
 #include <sycl/sycl.hpp>
 
@@ -15,6 +18,8 @@ using namespace benchmark_common;
 enum class FunctionName {
   SIN,
   SINH,
+  SINCOS,
+  SINHCOSH,
   ASIN,
   ASINH,
   COS,
@@ -26,9 +31,19 @@ enum class FunctionName {
   ATAN,
   ATANH,
   EXP,
+  EXPM1,
+  CIS,
+  EXPI,
   LOG,
   LOG10,
-  SQRT
+  LOG_ABS,
+  LOG1P,
+  FADDEEVA,
+  SQRT,
+  SQRT_POLAR,
+  POW_INT,
+  POW_INT_STATIC,
+  POW_REAL
 };
 
 template <Cplx cplx, typename R, FunctionName F> struct complex_function;
@@ -59,6 +74,71 @@ struct complex_function<cplx, R, FunctionName::ASIN> {
   }
 };
 
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::ASINH> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      return sycl::ext::cplx::asinh(a);
+    } else {
+      return std::asinh(a);
+    }
+  }
+};
+
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::ACOSH> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      return sycl::ext::cplx::acosh(a);
+    } else {
+      return std::acosh(a);
+    }
+  }
+};
+
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::ATANH> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      return sycl::ext::cplx::atanh(a);
+    } else {
+      return std::atanh(a);
+    }
+  }
+};
+
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::ATAN> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      return sycl::ext::cplx::atan(a);
+    } else {
+      return std::atan(a);
+    }
+  }
+};
+
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::ACOS> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      return sycl::ext::cplx::acos(a);
+    } else {
+      return std::acos(a);
+    }
+  }
+};
+
 template <Cplx cplx, typename R>
 struct complex_function<cplx, R, FunctionName::SINH> {
   using T = complex_t<cplx, R>;
@@ -85,6 +165,69 @@ struct complex_function<cplx, R, FunctionName::LOG> {
   }
 };
 
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::LOG10> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      return sycl::ext::cplx::log10(a);
+    } else {
+      return std::log10(a);
+    }
+  }
+};
+
+// Log-magnitude, against log(abs(z))
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::LOG_ABS> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      return T(sycl::ext::cplx::log_abs(a));
+    } else {
+      return T(std::log(std::abs(a)));
+    }
+  }
+};
+
+// Against the usual workaround of exp(z) - 1 evaluated in double
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::EXPM1> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      return sycl::ext::cplx::expm1(a);
+    } else {
+      return T(std::exp(std::complex<double>(a)) - 1.0);
+    }
+  }
+};
+
+// Against the usual workaround of log(1 + z) evaluated in double
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::LOG1P> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      return sycl::ext::cplx::log1p(a);
+    } else {
+      return T(std::log(1.0 + std::complex<double>(a)));
+    }
+  }
+};
+
+// std::complex has no error functions, so only the EXT variant is registered
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::FADDEEVA> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const { return sycl::ext::cplx::faddeeva(a); }
+};
+
 template <Cplx cplx, typename R>
 struct complex_function<cplx, R, FunctionName::SQRT> {
   using T = complex_t<cplx, R>;
@@ -98,6 +241,47 @@ struct complex_function<cplx, R, FunctionName::SQRT> {
   }
 };
 
+// The former polar form of sqrt, as reference for the algebraic one
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::SQRT_POLAR> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      return sycl::ext::cplx::polar(sycl::sqrt(sycl::ext::cplx::abs(a)),
+                                    sycl::ext::cplx::arg(a) / R(2));
+    } else {
+      return std::polar(std::sqrt(std::abs(a)), std::arg(a) / R(2));
+    }
+  }
+};
+
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::TAN> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      return sycl::ext::cplx::tan(a);
+    } else {
+      return std::tan(a);
+    }
+  }
+};
+
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::TANH> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      return sycl::ext::cplx::tanh(a);
+    } else {
+      return std::tanh(a);
+    }
+  }
+};
+
 template <Cplx cplx, typename R>
 struct complex_function<cplx, R, FunctionName::EXP> {
   using T = complex_t<cplx, R>;
@@ -111,6 +295,107 @@ struct complex_function<cplx, R, FunctionName::EXP> {
   }
 };
 
+// exp(i theta) of the real part, against std::polar
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::CIS> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      return sycl::ext::cplx::cis(a.real());
+    } else {
+      return std::polar(R(1), a.real());
+    }
+  }
+};
+
+// exp(i theta) of the real part, against std::exp of a pure imaginary
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::EXPI> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      return sycl::ext::cplx::expi(a.real());
+    } else {
+      return std::exp(T(R(0), a.real()));
+    }
+  }
+};
+
+// Cube with the exponent known at run time
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::POW_INT> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      return sycl::ext::cplx::pow(a, 3);
+    } else {
+      return std::pow(a, 3);
+    }
+  }
+};
+
+// Cube with the exponent known at compile time, against two products
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::POW_INT_STATIC> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      return sycl::ext::cplx::pow<3>(a);
+    } else {
+      return a * a * a;
+    }
+  }
+};
+
+// Fractional real exponent
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::POW_REAL> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      return sycl::ext::cplx::pow(a, R(0.37));
+    } else {
+      return std::pow(a, R(0.37));
+    }
+  }
+};
+
+// Both results are needed, std::complex computes them separately
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::SINCOS> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      T c;
+      T s = sycl::ext::cplx::sincos(a, &c);
+      return s + c;
+    } else {
+      return std::sin(a) + std::cos(a);
+    }
+  }
+};
+
+template <Cplx cplx, typename R>
+struct complex_function<cplx, R, FunctionName::SINHCOSH> {
+  using T = complex_t<cplx, R>;
+
+  T operator()(const T &a) const {
+    if constexpr (cplx == Cplx::EXT) {
+      T c;
+      T s = sycl::ext::cplx::sinhcosh(a, &c);
+      return s + c;
+    } else {
+      return std::sinh(a) + std::cosh(a);
+    }
+  }
+};
+
 template <typename R> class BenchmarkData {
 public:
   BenchmarkData(std::size_t max_n)
@@ -161,6 +446,37 @@ template <typename R> auto get_benchmark_data(std::size_t max_n) {
   return data;
 }
 
+// std::complex<long double> serves as the reference for the accuracy of a
+// function, unless its STD variant is a workaround rather than the function
+// or does not exist
+template <FunctionName F>
+constexpr bool has_reference = F != FunctionName::EXPM1 &&
+                               F != FunctionName::LOG1P &&
+                               F != FunctionName::FADDEEVA;
+
+// Largest normwise relative error, in units of the epsilon of R, of the first
+// results against the reference evaluated on the host
+template <typename R, FunctionName F, typename T>
+double max_relative_error(sycl::queue &Q, const T *a, const T *b,
+                          std::size_t n) {
+  std::vector<T> h_a(n), h_b(n);
+  Q.copy(a, h_a.data(), n);
+  Q.copy(b, h_b.data(), n);
+  Q.wait();
+
+  complex_function<Cplx::STD, long double, F> reference{};
+  long double max_err = 0;
+  for (std::size_t i = 0; i < n; ++i) {
+    auto ref = reference(
+        std::complex<long double>(h_a[i].real(), h_a[i].imag()));
+    auto err = std::abs(
+        std::complex<long double>(h_b[i].real(), h_b[i].imag()) - ref);
+    if (std::isfinite(std::abs(ref)) && std::abs(ref) != 0)
+      max_err = std::max(max_err, err / std::abs(ref));
+  }
+  return static_cast<double>(max_err / std::numeric_limits<R>::epsilon());
+}
+
 template <Cplx cplx, typename R, FunctionName F, std::uint32_t SEED = 777>
 static void BM_function(benchmark::State &state) {
   using T = complex_t<cplx, R>;
@@ -180,6 +496,11 @@ static void BM_function(benchmark::State &state) {
     Q.parallel_for(sycl::range<1>(n), [=](sycl::id<1> i) { b[i] = fn(a[i]); });
     Q.wait();
   }
+
+  if constexpr (has_reference<F>) {
+    state.counters["max_err_eps"] = max_relative_error<R, F>(
+        Q, a, b, std::min<std::size_t>(n, 4096));
+  }
 }
 
 // Size of each vector is N * 16 bytes for complex double,
@@ -225,6 +546,97 @@ BENCHMARK(BM_function<Cplx::STD, double, FunctionName::ASIN>)
     ->Args({N})
     ->Unit(benchmark::kMillisecond);
 
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::ASINH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::ASINH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::ASINH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::ASINH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::ACOSH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::ACOSH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::ACOSH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::ACOSH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::ATANH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::ATANH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::ATANH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::ATANH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::ATAN>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::ATAN>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::ATAN>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::ATAN>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::ACOS>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::ACOS>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::ACOS>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::ACOS>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::TAN>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::TAN>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::TAN>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::TAN>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::TANH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::TANH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::TANH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::TANH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::LOG>)
     ->Args({N})
     ->Unit(benchmark::kMillisecond);
@@ -238,6 +650,65 @@ BENCHMARK(BM_function<Cplx::STD, double, FunctionName::LOG>)
     ->Args({N})
     ->Unit(benchmark::kMillisecond);
 
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::LOG10>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::LOG10>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::LOG10>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::LOG10>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::LOG_ABS>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::LOG_ABS>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::LOG_ABS>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::LOG_ABS>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::EXPM1>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::EXPM1>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::EXPM1>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::EXPM1>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::LOG1P>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::LOG1P>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::LOG1P>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::LOG1P>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::FADDEEVA>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::FADDEEVA>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::SQRT>)
     ->Args({N})
     ->Unit(benchmark::kMillisecond);
@@ -251,6 +722,19 @@ BENCHMARK(BM_function<Cplx::STD, double, FunctionName::SQRT>)
     ->Args({N})
     ->Unit(benchmark::kMillisecond);
 
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::SQRT_POLAR>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::SQRT_POLAR>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::SQRT_POLAR>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::SQRT_POLAR>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::EXP>)
     ->Args({N})
     ->Unit(benchmark::kMillisecond);
@@ -264,4 +748,95 @@ BENCHMARK(BM_function<Cplx::STD, double, FunctionName::EXP>)
     ->Args({N})
     ->Unit(benchmark::kMillisecond);
 
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::CIS>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::CIS>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::CIS>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::CIS>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::EXPI>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::EXPI>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::EXPI>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::EXPI>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::POW_INT>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::POW_INT>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::POW_INT>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::POW_INT>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::POW_INT_STATIC>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::POW_INT_STATIC>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::POW_INT_STATIC>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::POW_INT_STATIC>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::POW_REAL>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::POW_REAL>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::POW_REAL>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::POW_REAL>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::SINCOS>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::SINCOS>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::SINCOS>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::SINCOS>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_function<Cplx::EXT, float, FunctionName::SINHCOSH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, float, FunctionName::SINHCOSH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::EXT, double, FunctionName::SINHCOSH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_function<Cplx::STD, double, FunctionName::SINHCOSH>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK_MAIN();
@@ -0,0 +1,337 @@
+#include <functional>
+#include <type_traits>
+
+#include <sycl/sycl.hpp>
+
+#include "sycl_ext_complex.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include "benchmark_common.h"
+using namespace benchmark_common;
+
+// EXT goes through the group algorithms of sycl_ext_complex.hpp, COMPONENTS
+// calls one native collective per component. For multiplies the COMPONENTS
+// result is not the complex product; it is only kept as a cost baseline.
+enum class Path { EXT, COMPONENTS };
+
+enum class Algorithm { REDUCE, INCLUSIVE_SCAN };
+
+enum class Scope { GROUP, SUB_GROUP };
+
+enum class OpName { PLUS, MULTIPLIES, COMPENSATED_PLUS };
+
+template <OpName opname> struct Op;
+
+template <> struct Op<OpName::PLUS> {
+  using type = sycl::plus<>;
+};
+
+template <> struct Op<OpName::MULTIPLIES> {
+  using type = sycl::multiplies<>;
+};
+
+template <> struct Op<OpName::COMPENSATED_PLUS> {
+  using type = sycl::ext::cplx::compensated_plus;
+};
+
+template <Path path, Algorithm algorithm, typename Group, typename T,
+          typename BinaryOperation>
+T group_algorithm(Group g, T x, BinaryOperation binary_op) {
+  if constexpr (path == Path::EXT) {
+    if constexpr (algorithm == Algorithm::REDUCE)
+      return sycl::ext::cplx::reduce_over_group(g, x, binary_op);
+    else
+      return sycl::ext::cplx::inclusive_scan_over_group(g, x, binary_op);
+  } else {
+    if constexpr (algorithm == Algorithm::REDUCE)
+      return T(sycl::reduce_over_group(g, x.real(), binary_op),
+               sycl::reduce_over_group(g, x.imag(), binary_op));
+    else
+      return T(sycl::inclusive_scan_over_group(g, x.real(), binary_op),
+               sycl::inclusive_scan_over_group(g, x.imag(), binary_op));
+  }
+}
+
+template <typename R> class BenchmarkData {
+public:
+  BenchmarkData(std::size_t max_n)
+      : q_(sycl::default_selector_v), max_n_(max_n) {
+    R *h_random_data = sycl::malloc_host<R>(max_n * 2, q_);
+
+    d_a_ = sycl::malloc_device<R>(max_n * 2, q_);
+    d_c_ = sycl::malloc_device<R>(max_n * 2, q_);
+
+    fill_random(h_random_data, max_n * 2);
+    q_.copy(h_random_data, d_a_, 2 * max_n);
+    q_.wait();
+
+    sycl::free(h_random_data, q_);
+  }
+
+  ~BenchmarkData() {
+    sycl::free(d_a_, q_);
+    sycl::free(d_c_, q_);
+  }
+
+  template <typename T> T *get_device_input(std::size_t n) {
+    assert(n <= max_n_);
+    return reinterpret_cast<T *>(d_a_);
+  }
+
+  template <typename T> T *get_device_output(std::size_t n) {
+    assert(n <= max_n_);
+    return reinterpret_cast<T *>(d_c_);
+  }
+
+  sycl::queue &get_queue() { return q_; }
+
+private:
+  sycl::queue q_;
+  std::size_t max_n_;
+  R *d_a_;
+  R *d_c_;
+};
+
+template <typename R> auto get_benchmark_data(std::size_t max_n) {
+  static BenchmarkData<R> *data = nullptr;
+  if (data == nullptr) {
+    data = new BenchmarkData<R>(max_n);
+  }
+  return data;
+}
+
+template <Path path, typename R, Algorithm algorithm, OpName opname,
+          Scope scope>
+static void BM_group_algorithm(benchmark::State &state) {
+  using T = sycl::ext::cplx::complex<R>;
+
+  int n = state.range(0);
+  int wg_size = state.range(1);
+
+  auto bench_data = get_benchmark_data<R>(n);
+
+  auto a = bench_data->template get_device_input<T>(n);
+  auto c = bench_data->template get_device_output<T>(n);
+
+  sycl::queue &Q = bench_data->get_queue();
+
+  typename Op<opname>::type binary_op{};
+
+  for (auto _ : state) {
+    Q.parallel_for(sycl::nd_range<1>(n, wg_size), [=](sycl::nd_item<1> it) {
+      auto i = it.get_global_id(0);
+      if constexpr (scope == Scope::SUB_GROUP)
+        c[i] = group_algorithm<path, algorithm>(it.get_sub_group(), a[i],
+                                                binary_op);
+      else
+        c[i] = group_algorithm<path, algorithm>(it.get_group(), a[i],
+                                                binary_op);
+    });
+    Q.wait();
+  }
+}
+
+// Each work-group reduces its own slice of `slice` elements
+template <typename R, OpName opname>
+static void BM_joint_reduce(benchmark::State &state) {
+  using T = sycl::ext::cplx::complex<R>;
+
+  int n = state.range(0);
+  int wg_size = state.range(1);
+  int slice = state.range(2);
+
+  auto bench_data = get_benchmark_data<R>(n);
+
+  auto a = bench_data->template get_device_input<T>(n);
+  auto c = bench_data->template get_device_output<T>(n);
+
+  sycl::queue &Q = bench_data->get_queue();
+
+  typename Op<opname>::type binary_op{};
+
+  for (auto _ : state) {
+    Q.parallel_for(sycl::nd_range<1>(n / slice * wg_size, wg_size),
+                   [=](sycl::nd_item<1> it) {
+                     auto g = it.get_group();
+                     auto first = a + g.get_group_linear_id() * slice;
+                     auto result = sycl::ext::cplx::joint_reduce(
+                         g, first, first + slice, binary_op);
+                     if (g.leader())
+                       c[g.get_group_linear_id()] = result;
+                   });
+    Q.wait();
+  }
+
+  state.SetBytesProcessed(state.iterations() * n * sizeof(T));
+}
+
+// Each work-group scans its own slice of `slice` elements
+template <typename R, OpName opname>
+static void BM_joint_inclusive_scan(benchmark::State &state) {
+  using T = sycl::ext::cplx::complex<R>;
+
+  int n = state.range(0);
+  int wg_size = state.range(1);
+  int slice = state.range(2);
+
+  auto bench_data = get_benchmark_data<R>(n);
+
+  auto a = bench_data->template get_device_input<T>(n);
+  auto c = bench_data->template get_device_output<T>(n);
+
+  sycl::queue &Q = bench_data->get_queue();
+
+  typename Op<opname>::type binary_op{};
+
+  for (auto _ : state) {
+    Q.parallel_for(sycl::nd_range<1>(n / slice * wg_size, wg_size),
+                   [=](sycl::nd_item<1> it) {
+                     auto g = it.get_group();
+                     auto offset = g.get_group_linear_id() * slice;
+                     sycl::ext::cplx::joint_inclusive_scan(
+                         g, a + offset, a + offset + slice, c + offset,
+                         binary_op);
+                   });
+    Q.wait();
+  }
+
+  state.SetBytesProcessed(state.iterations() * n * sizeof(T) * 2);
+}
+
+// Size of each vector is N * 16 bytes for complex double,
+// so with two vectors, that is 16 * 16 * 2 = 512 MB.
+constexpr int N = 16 * 1024 * 1024;
+constexpr int WG = 256;
+
+BENCHMARK(BM_group_algorithm<Path::EXT, float, Algorithm::REDUCE,
+                             OpName::PLUS, Scope::SUB_GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_group_algorithm<Path::COMPONENTS, float, Algorithm::REDUCE,
+                             OpName::PLUS, Scope::SUB_GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_group_algorithm<Path::EXT, double, Algorithm::REDUCE,
+                             OpName::PLUS, Scope::SUB_GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_group_algorithm<Path::COMPONENTS, double, Algorithm::REDUCE,
+                             OpName::PLUS, Scope::SUB_GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+
+// One packed collective against one collective per component
+BENCHMARK(BM_group_algorithm<Path::EXT, float, Algorithm::REDUCE,
+                             OpName::PLUS, Scope::GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_group_algorithm<Path::COMPONENTS, float, Algorithm::REDUCE,
+                             OpName::PLUS, Scope::GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_group_algorithm<Path::EXT, double, Algorithm::REDUCE,
+                             OpName::PLUS, Scope::GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_group_algorithm<Path::COMPONENTS, double, Algorithm::REDUCE,
+                             OpName::PLUS, Scope::GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_group_algorithm<Path::EXT, float, Algorithm::REDUCE,
+                             OpName::MULTIPLIES, Scope::SUB_GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_group_algorithm<Path::COMPONENTS, float, Algorithm::REDUCE,
+                             OpName::MULTIPLIES, Scope::SUB_GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_group_algorithm<Path::EXT, double, Algorithm::REDUCE,
+                             OpName::MULTIPLIES, Scope::SUB_GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_group_algorithm<Path::COMPONENTS, double, Algorithm::REDUCE,
+                             OpName::MULTIPLIES, Scope::SUB_GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+
+// Exact work-group products against one collective per component
+BENCHMARK(BM_group_algorithm<Path::EXT, float, Algorithm::REDUCE,
+                             OpName::MULTIPLIES, Scope::GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_group_algorithm<Path::COMPONENTS, float, Algorithm::REDUCE,
+                             OpName::MULTIPLIES, Scope::GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_group_algorithm<Path::EXT, double, Algorithm::REDUCE,
+                             OpName::MULTIPLIES, Scope::GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_group_algorithm<Path::COMPONENTS, double, Algorithm::REDUCE,
+                             OpName::MULTIPLIES, Scope::GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_group_algorithm<Path::EXT, float, Algorithm::INCLUSIVE_SCAN,
+                             OpName::MULTIPLIES, Scope::SUB_GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_group_algorithm<Path::COMPONENTS, float, Algorithm::INCLUSIVE_SCAN,
+                             OpName::MULTIPLIES, Scope::SUB_GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_group_algorithm<Path::EXT, double, Algorithm::INCLUSIVE_SCAN,
+                             OpName::MULTIPLIES, Scope::SUB_GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_group_algorithm<Path::COMPONENTS, double,
+                             Algorithm::INCLUSIVE_SCAN, OpName::MULTIPLIES,
+                             Scope::SUB_GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_group_algorithm<Path::EXT, float, Algorithm::INCLUSIVE_SCAN,
+                             OpName::MULTIPLIES, Scope::GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_group_algorithm<Path::COMPONENTS, float, Algorithm::INCLUSIVE_SCAN,
+                             OpName::MULTIPLIES, Scope::GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_group_algorithm<Path::EXT, double, Algorithm::INCLUSIVE_SCAN,
+                             OpName::MULTIPLIES, Scope::GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_group_algorithm<Path::COMPONENTS, double,
+                             Algorithm::INCLUSIVE_SCAN, OpName::MULTIPLIES,
+                             Scope::GROUP>)
+    ->Args({N, WG})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_joint_reduce<float, OpName::PLUS>)
+    ->Args({N, WG, 64 * 1024})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_joint_reduce<double, OpName::PLUS>)
+    ->Args({N, WG, 64 * 1024})
+    ->Unit(benchmark::kMillisecond);
+// Compensated float sums against the double path they replace
+BENCHMARK(BM_joint_reduce<float, OpName::COMPENSATED_PLUS>)
+    ->Args({N, WG, 64 * 1024})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_joint_inclusive_scan<float, OpName::PLUS>)
+    ->Args({N, WG, 64 * 1024})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_joint_inclusive_scan<double, OpName::PLUS>)
+    ->Args({N, WG, 64 * 1024})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
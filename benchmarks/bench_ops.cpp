@@ -58,6 +58,26 @@ template <typename T> struct Op<T, OpName::DIVIDES_REAL> {
   T operator()(const T &a, const type2 &b) const { return a / b; }
 };
 
+template <typename T, OpName opname, typename Policy> struct PolicyOp;
+
+template <typename T, typename Policy>
+struct PolicyOp<T, OpName::MULTIPLIES, Policy> {
+  using type1 = T;
+  using type2 = T;
+  T operator()(const T &a, const T &b) const {
+    return sycl::ext::cplx::multiply(a, b, Policy{});
+  }
+};
+
+template <typename T, typename Policy>
+struct PolicyOp<T, OpName::DIVIDES, Policy> {
+  using type1 = T;
+  using type2 = T;
+  T operator()(const T &a, const T &b) const {
+    return sycl::ext::cplx::divide(a, b, Policy{});
+  }
+};
+
 template <typename R> class BenchmarkData {
 public:
   BenchmarkData(std::size_t max_n)
@@ -116,11 +136,8 @@ template <typename R> auto get_benchmark_data(std::size_t max_n) {
   return data;
 }
 
-template <Cplx cplx, typename R, OpName opname, std::uint32_t SEED = 777>
-static void BM_binary_op(benchmark::State &state) {
-  using T = complex_t<cplx, R>;
-  using OpClass = Op<T, opname>;
-
+template <typename R, typename T, typename OpClass>
+static void run_binary_op(benchmark::State &state) {
   int n = state.range(0);
 
   auto bench_data = get_benchmark_data<R>(n);
@@ -140,6 +157,19 @@ static void BM_binary_op(benchmark::State &state) {
   }
 }
 
+template <Cplx cplx, typename R, OpName opname, std::uint32_t SEED = 777>
+static void BM_binary_op(benchmark::State &state) {
+  using T = complex_t<cplx, R>;
+  run_binary_op<R, T, Op<T, opname>>(state);
+}
+
+// Same operation with an explicit accuracy policy (ieee, finite_only, fast)
+template <typename R, OpName opname, typename Policy>
+static void BM_policy_op(benchmark::State &state) {
+  using T = complex_t<Cplx::EXT, R>;
+  run_binary_op<R, T, PolicyOp<T, opname, Policy>>(state);
+}
+
 // Size of each vector is N * 16 bytes for complex double,
 // so with three vectors, that is 16 * 16 * 3 = 768 MB.
 constexpr int N = 16 * 1024 * 1024;
@@ -228,4 +258,45 @@ BENCHMARK(BM_binary_op<Cplx::STD, double, OpName::DIVIDES_REAL>)
     ->Args({N})
     ->Unit(benchmark::kMillisecond);
 
+BENCHMARK(BM_policy_op<float, OpName::MULTIPLIES, sycl::ext::cplx::ieee>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_policy_op<float, OpName::MULTIPLIES, sycl::ext::cplx::finite_only>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_policy_op<float, OpName::MULTIPLIES, sycl::ext::cplx::fast>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_policy_op<double, OpName::MULTIPLIES, sycl::ext::cplx::ieee>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(
+    BM_policy_op<double, OpName::MULTIPLIES, sycl::ext::cplx::finite_only>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_policy_op<double, OpName::MULTIPLIES, sycl::ext::cplx::fast>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_policy_op<float, OpName::DIVIDES, sycl::ext::cplx::ieee>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_policy_op<float, OpName::DIVIDES, sycl::ext::cplx::finite_only>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_policy_op<float, OpName::DIVIDES, sycl::ext::cplx::fast>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_policy_op<double, OpName::DIVIDES, sycl::ext::cplx::ieee>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_policy_op<double, OpName::DIVIDES, sycl::ext::cplx::finite_only>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_policy_op<double, OpName::DIVIDES, sycl::ext::cplx::fast>)
+    ->Args({N})
+    ->Unit(benchmark::kMillisecond);
+
 BENCHMARK_MAIN();
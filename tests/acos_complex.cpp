@@ -61,6 +61,50 @@ TEMPLATE_TEST_CASE("Test complex acos", "[acos]", double, float, sycl::half) {
   check_results(h_cplx_out, h_std_out, /*tol_multiplier*/ 2);
 }
 
+TEMPLATE_TEST_CASE("Test complex acos accuracy", "[acos]", double, float,
+                   sycl::half) {
+  using T = TestType;
+  using std_T = std::conditional_t<std::is_same_v<T, sycl::half>, float, T>;
+
+  sycl::queue Q;
+
+  // Around the branch points +-1, on the real segment, with a tiny
+  // imaginary part and at magnitudes where the square of z overflows
+  const std_T big = std_T(std::numeric_limits<T>::max()) / 4;
+  const std_T t = std::ldexp(std_T(1), std::is_same_v<T, double>  ? -30
+                                       : std::is_same_v<T, float> ? -15
+                                                                  : -7);
+  cmplx<T> input = GENERATE_COPY(
+      cmplx<T>{T(1), T(t)}, cmplx<T>{T(1 + t), T(-t)},
+      cmplx<T>{T(-1 + t), T(0.25)}, cmplx<T>{T(t * t), T(0.75)},
+      cmplx<T>{T(0.5), T(t)}, cmplx<T>{T(-0.875), T(0)},
+      cmplx<T>{T(-big / 8), T(big)}, cmplx<T>{T(big), T(-1.5)});
+  std::complex<long double> ref =
+      std::acos(std::complex<long double>(std_T(input.re), std_T(input.im)));
+  std::complex<T> std_out{T(std_T(ref.real())), T(std_T(ref.imag()))};
+
+  sycl::ext::cplx::complex<T> cplx_input{input.re, input.im};
+
+  sycl::ext::cplx::complex<T> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<sycl::ext::cplx::complex<T>>(1, Q);
+
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = sycl::ext::cplx::acos(cplx_input);
+     }).wait();
+    Q.copy(d_cplx_out, &h_cplx_out, 1).wait();
+    check_results(h_cplx_out.real(), std_out.real());
+    check_results(h_cplx_out.imag(), std_out.imag());
+  }
+
+  h_cplx_out = sycl::ext::cplx::acos(cplx_input);
+
+  check_results(h_cplx_out.real(), std_out.real());
+  check_results(h_cplx_out.imag(), std_out.imag());
+
+  sycl::free(d_cplx_out, Q);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // MARRAY<COMPLEX> TESTS'S UTILITIES
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,100 @@
+#include "test_helper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPLEX TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE("Test complex cis", "[cis]", double, float, sycl::half) {
+  using T = TestType;
+
+  sycl::queue Q;
+
+  // Test cases
+  T theta = GENERATE(T(0), T(-0.), T(1), T(2.02), T(3.14), T(-3.14), T(-12.5),
+                     inf_val<T>, nan_val<T>);
+
+  std::complex<T> std_out{};
+  sycl::ext::cplx::complex<T> h_cplx_out[2];
+  auto d_cplx_out = sycl::malloc_device<sycl::ext::cplx::complex<T>>(2, Q);
+
+  // Get std::complex output
+  if (std::isfinite(theta))
+    std_out = std::polar(T(1), theta);
+  else
+    std_out = std::complex<T>(nan_val<T>, nan_val<T>);
+
+  // Check cplx::complex output from device
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = sycl::ext::cplx::cis<T>(theta);
+       d_cplx_out[1] = sycl::ext::cplx::expi<T>(theta);
+     }).wait();
+    Q.copy(d_cplx_out, h_cplx_out, 2).wait();
+
+    check_results(h_cplx_out[0], std_out);
+    check_results(h_cplx_out[1], std_out);
+  }
+
+  // Check cplx::complex output from host
+  h_cplx_out[0] = sycl::ext::cplx::cis<T>(theta);
+  h_cplx_out[1] = sycl::ext::cplx::expi<T>(theta);
+
+  check_results(h_cplx_out[0], std_out);
+  check_results(h_cplx_out[1], std_out);
+
+  // Same as exp of a pure imaginary number, signed zeros included
+  auto cplx_exp = sycl::ext::cplx::exp<T>(
+      sycl::ext::cplx::complex<T>(T(0), theta));
+  CHECK(std::signbit(h_cplx_out[0].imag()) == std::signbit(cplx_exp.imag()));
+  check_results(h_cplx_out[0], cplx_exp);
+
+  sycl::free(d_cplx_out, Q);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// MARRAY<COMPLEX> TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE_SIG("Test marray complex cis", "[cis]",
+                       ((typename T, std::size_t NumElements), T, NumElements),
+                       (double, 4), (float, 4), (sycl::half, 4)) {
+  sycl::queue Q;
+
+  // Test cases
+  const auto theta = GENERATE(sycl::marray<T, NumElements>{
+      1.0,
+      2.02,
+      3.5,
+      -3.14,
+  });
+
+  sycl::marray<std::complex<T>, NumElements> std_out{};
+  sycl::marray<sycl::ext::cplx::complex<T>, NumElements> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<
+      sycl::marray<sycl::ext::cplx::complex<T>, NumElements>>(1, Q);
+
+  // Get std::complex output
+  for (std::size_t i = 0; i < NumElements; ++i)
+    std_out[i] = std::polar(T(1), theta[i]);
+
+  // Check cplx::complex output from device
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = sycl::ext::cplx::cis<T>(theta);
+     }).wait();
+    Q.copy(d_cplx_out, &h_cplx_out, 1).wait();
+
+    check_results(h_cplx_out, std_out);
+  }
+
+  // Check cplx::complex output from host
+  h_cplx_out = sycl::ext::cplx::cis<T>(theta);
+
+  check_results(h_cplx_out, std_out);
+
+  h_cplx_out = sycl::ext::cplx::expi<T>(theta);
+
+  check_results(h_cplx_out, std_out);
+
+  sycl::free(d_cplx_out, Q);
+}
@@ -0,0 +1,63 @@
+#include <numeric>
+#include <vector>
+
+#include "test_helper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// UTILITY FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+void test_dot(sycl::queue q, const std::vector<T> &x,
+              const std::vector<T> &y) {
+  const std::size_t N = x.size();
+
+  auto *d_x = sycl::malloc_device<T>(N, q);
+  auto *d_y = sycl::malloc_device<T>(N, q);
+
+  q.copy(x.data(), d_x, N);
+  q.copy(y.data(), d_y, N);
+  q.wait();
+
+  const auto output_dotu = sycl::ext::cplx::dotu(q, d_x, d_y, N);
+  const auto output_dotc = sycl::ext::cplx::dotc(q, d_x, d_y, N);
+
+  const auto expected_dotu =
+      std::inner_product(x.begin(), x.end(), y.begin(), T{});
+  const auto expected_dotc = std::inner_product(
+      x.begin(), x.end(), y.begin(), T{}, std::plus<>(),
+      [](T a, T b) { return sycl::ext::cplx::conj(a) * b; });
+
+  check_results(output_dotu, expected_dotu);
+  check_results(output_dotc, expected_dotc);
+
+  sycl::free(d_x, q);
+  sycl::free(d_y, q);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPLEX TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE("Test complex dotu and dotc", "[dot]", double, float,
+                   sycl::half) {
+  using T = TestType;
+  using Complex = typename sycl::ext::cplx::complex<T>;
+
+  sycl::queue q;
+
+  // Sizes below, at and above one work-group, and spanning many work-groups
+  const auto N = GENERATE(1, 7, 64, 1000, 4099);
+
+  // Small integers whose products average to zero, so that every partial sum
+  // stays exact, even in half precision
+  std::vector<Complex> x(N), y(N);
+  for (std::size_t i = 0; i < x.size(); i++) {
+    x[i] = Complex{T(int(i % 3) - 1), T(int(i % 5 == 0))};
+    y[i] = Complex{T(int(i % 7 == 0)), T(int(i % 4) - 2)};
+  }
+
+  if (is_type_supported<T>(q)) {
+    test_dot(q, x, y);
+  }
+}
@@ -0,0 +1,201 @@
+#include "test_helper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPLEX TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE("Test complex erf, erfc, erfcx and faddeeva", "[erf]",
+                   double, float, sycl::half) {
+  using T = TestType;
+  using std::make_tuple;
+
+  sycl::queue Q;
+
+  // Reference values computed to 40 digits; the inputs are exact in half
+  cmplx<T> input, erf_ref, erfc_ref, erfcx_ref, w_ref;
+  std::tie(input, erf_ref, erfc_ref, erfcx_ref, w_ref) =
+      GENERATE(table<cmplx<T>, cmplx<T>, cmplx<T>, cmplx<T>, cmplx<T>>(
+          {make_tuple(cmplx<T>{0.375, 0.25},
+                      cmplx<T>{0.42775705141504261, 0.24880288606784887},
+                      cmplx<T>{0.57224294858495739, -0.24880288606784887},
+                      cmplx<T>{0.65804388253005904, -0.14896945495331197},
+                      cmplx<T>{0.69275306708948499, 0.2586782825710593}),
+           make_tuple(cmplx<T>{1.0, 1.0},
+                      cmplx<T>{1.3161512816979476, 0.19045346923783469},
+                      cmplx<T>{-0.31615128169794764, -0.19045346923783469},
+                      cmplx<T>{0.30474420525691259, -0.20821893820283163},
+                      cmplx<T>{0.30474420525691259, 0.20821893820283163}),
+           make_tuple(cmplx<T>{-2.0, 0.5},
+                      cmplx<T>{-1.0035022433130363, 0.0047409030312943361},
+                      cmplx<T>{2.0035022433130363, -0.0047409030312943361},
+                      cmplx<T>{-35.635303512001889, -77.380142375345435},
+                      cmplx<T>{0.10335882374136666, -0.28478588475009375}),
+           make_tuple(cmplx<T>{3.0, -2.0},
+                      cmplx<T>{0.99896327885681727, 1.1546724379290603e-5},
+                      cmplx<T>{0.0010367211431827311, -1.1546724379290603e-5},
+                      cmplx<T>{0.13075746966984857, 0.081112650477456653},
+                      cmplx<T>{-0.08133907992862736, 0.12108616246299845}),
+           make_tuple(cmplx<T>{0, 2.0}, cmplx<T>{0, 18.564802414575553},
+                      cmplx<T>{1.0, -18.564802414575553},
+                      cmplx<T>{0.01831563888873418, -0.3400262170660662},
+                      cmplx<T>{0.25539567631050574, 0}),
+           make_tuple(cmplx<T>{5.5, 0.015625},
+                      cmplx<T>{0.99999999999999275, 1.2786799422938344e-15},
+                      cmplx<T>{7.2476855387629533e-15, -1.2786799422938344e-15},
+                      cmplx<T>{0.10096146376309818, -2.7804117872324584e-4},
+                      cmplx<T>{3.0722582604070706e-4, 0.10436651431452884}),
+           make_tuple(cmplx<T>{0.125, -0.25},
+                      cmplx<T>{0.14926900258817802, -0.28342959188880684},
+                      cmplx<T>{0.85073099741182198, 0.28342959188880684},
+                      cmplx<T>{0.82708035807567357, 0.21921955478202889},
+                      cmplx<T>{1.3306176470290125, 0.22304101132287171}),
+           make_tuple(cmplx<T>{-6.5, -3.0},
+                      cmplx<T>{-1.0, -2.807156599881604e-16},
+                      cmplx<T>{2.0, 2.807156599881604e-16},
+                      cmplx<T>{1.4697775033208543e+14, 5.3125907520870881e+14},
+                      cmplx<T>{-0.033784762223265174, -0.071749793067020889}),
+           make_tuple(cmplx<T>{inf_val<T>, 2.02}, cmplx<T>{1, 0},
+                      cmplx<T>{0, 0}, cmplx<T>{0, 0}, cmplx<T>{0, 0}),
+           make_tuple(cmplx<T>{-inf_val<T>, 2.02}, cmplx<T>{-1, 0},
+                      cmplx<T>{2, 0}, cmplx<T>{inf_val<T>, nan_val<T>},
+                      cmplx<T>{0, 0}),
+           make_tuple(cmplx<T>{nan_val<T>, 2.02},
+                      cmplx<T>{nan_val<T>, nan_val<T>},
+                      cmplx<T>{nan_val<T>, nan_val<T>},
+                      cmplx<T>{nan_val<T>, nan_val<T>},
+                      cmplx<T>{nan_val<T>, nan_val<T>})}));
+
+  constexpr std::size_t N = 4;
+  std::array<std::complex<T>, N> std_out{
+      init_std_complex(erf_ref), init_std_complex(erfc_ref),
+      init_std_complex(erfcx_ref), init_std_complex(w_ref)};
+
+  sycl::ext::cplx::complex<T> cplx_input{input.re, input.im};
+
+  auto apply = [](sycl::ext::cplx::complex<T> z) {
+    return std::array<sycl::ext::cplx::complex<T>, N>{
+        sycl::ext::cplx::erf(z), sycl::ext::cplx::erfc(z),
+        sycl::ext::cplx::erfcx(z), sycl::ext::cplx::faddeeva(z)};
+  };
+
+  std::array<sycl::ext::cplx::complex<T>, N> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<sycl::ext::cplx::complex<T>>(N, Q);
+
+  // Check cplx::complex output from device
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       auto out = apply(cplx_input);
+       for (std::size_t i = 0; i < N; ++i)
+         d_cplx_out[i] = out[i];
+     }).wait();
+    Q.copy(d_cplx_out, h_cplx_out.data(), N).wait();
+    for (std::size_t i = 0; i < N; ++i)
+      check_results(h_cplx_out[i], std_out[i]);
+  }
+
+  // Check cplx::complex output from host
+  h_cplx_out = apply(cplx_input);
+  for (std::size_t i = 0; i < N; ++i)
+    check_results(h_cplx_out[i], std_out[i]);
+
+  sycl::free(d_cplx_out, Q);
+}
+
+TEMPLATE_TEST_CASE("Test complex erf identities", "[erf]", double, float,
+                   sycl::half) {
+  using T = TestType;
+  namespace cplx = sycl::ext::cplx;
+
+  sycl::queue Q;
+
+  // Across the Taylor, rational and continued fraction regions and all four
+  // quadrants: erf + erfc = 1, and erfc(z) = exp(-z^2) erfcx(z) where the
+  // latter goes through w(i z) instead of exp(-z^2) w(i z)
+  cmplx<T> input = GENERATE(cmplx<T>{0.125, 0.375}, cmplx<T>{-0.25, -0.0625},
+                            cmplx<T>{1.5, -0.75}, cmplx<T>{-0.5, 2.5},
+                            cmplx<T>{6.5, 4.5}, cmplx<T>{-3.0, 0.5});
+
+  cplx::complex<T> cplx_input{input.re, input.im};
+
+  auto apply = [](cplx::complex<T> z) {
+    return std::array<cplx::complex<T>, 3>{cplx::erf(z) + cplx::erfc(z),
+                                           cplx::exp(-z * z) * cplx::erfcx(z),
+                                           cplx::erfc(z)};
+  };
+
+  std::array<cplx::complex<T>, 3> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<cplx::complex<T>>(3, Q);
+
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       auto out = apply(cplx_input);
+       for (std::size_t i = 0; i < 3; ++i)
+         d_cplx_out[i] = out[i];
+     }).wait();
+    Q.copy(d_cplx_out, h_cplx_out.data(), 3).wait();
+    check_results(h_cplx_out[0], std::complex<T>(1, 0), /*tol_multiplier*/ 2);
+    check_results(h_cplx_out[1], h_cplx_out[2], /*tol_multiplier*/ 2);
+  }
+
+  h_cplx_out = apply(cplx_input);
+  check_results(h_cplx_out[0], std::complex<T>(1, 0), /*tol_multiplier*/ 2);
+  check_results(h_cplx_out[1], h_cplx_out[2], /*tol_multiplier*/ 2);
+
+  sycl::free(d_cplx_out, Q);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// MARRAY<COMPLEX> TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE_SIG("Test marray complex erf", "[erf]",
+                       ((typename T, std::size_t NumElements), T, NumElements),
+                       (double, 8), (float, 8), (sycl::half, 8)) {
+  namespace cplx = sycl::ext::cplx;
+
+  sycl::queue Q;
+
+  sycl::marray<cplx::complex<T>, NumElements> cplx_input{
+      cplx::complex<T>{0.375, 0.25},     cplx::complex<T>{1.0, 1.0},
+      cplx::complex<T>{-2.0, 0.5},       cplx::complex<T>{3.0, -2.0},
+      cplx::complex<T>{0, 2.0},          cplx::complex<T>{5.5, 0.015625},
+      cplx::complex<T>{inf_val<T>, 2.0}, cplx::complex<T>{nan_val<T>, 2.0}};
+
+  // Element-wise reference from the scalar overloads
+  sycl::marray<std::complex<T>, NumElements> std_out[4];
+  for (std::size_t i = 0; i < NumElements; ++i) {
+    std_out[0][i] = cplx::erf(cplx_input[i]);
+    std_out[1][i] = cplx::erfc(cplx_input[i]);
+    std_out[2][i] = cplx::erfcx(cplx_input[i]);
+    std_out[3][i] = cplx::faddeeva(cplx_input[i]);
+  }
+
+  sycl::marray<cplx::complex<T>, NumElements> h_cplx_out[4];
+  auto d_cplx_out =
+      sycl::malloc_device<sycl::marray<cplx::complex<T>, NumElements>>(4, Q);
+
+  // Check cplx::complex output from device
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = cplx::erf<T>(cplx_input);
+       d_cplx_out[1] = cplx::erfc<T>(cplx_input);
+       d_cplx_out[2] = cplx::erfcx<T>(cplx_input);
+       d_cplx_out[3] = cplx::faddeeva<T>(cplx_input);
+     }).wait();
+    Q.copy(d_cplx_out, h_cplx_out, 4).wait();
+
+    for (std::size_t i = 0; i < 4; ++i)
+      check_results(h_cplx_out[i], std_out[i]);
+  }
+
+  // Check cplx::complex output from host
+  h_cplx_out[0] = cplx::erf<T>(cplx_input);
+  h_cplx_out[1] = cplx::erfc<T>(cplx_input);
+  h_cplx_out[2] = cplx::erfcx<T>(cplx_input);
+  h_cplx_out[3] = cplx::faddeeva<T>(cplx_input);
+
+  for (std::size_t i = 0; i < 4; ++i)
+    check_results(h_cplx_out[i], std_out[i]);
+
+  sycl::free(d_cplx_out, Q);
+}
@@ -56,12 +56,14 @@ void test_exclusive_scan_over_group(sycl::queue q, T input,
   }
 
   check_results(result, expected);
+  check_zero_parts(result, expected);
 
   for (std::size_t i = 0; i < N; i++) {
     result[i] = h_output_without_init[i];
   }
 
   check_results(result, expected);
+  check_zero_parts(result, expected);
 
   sycl::free(d_in, q);
   sycl::free(d_output_with_init, q);
@@ -72,6 +74,64 @@ void test_exclusive_scan_over_group(sycl::queue q, T input,
   sycl::free(h_output_without_init, q);
 }
 
+template <typename T, typename BinaryOperation>
+void test_exclusive_scan_over_sub_group(sycl::queue q, T input,
+                                        BinaryOperation binary_op) {
+  using V = typename T::value_type;
+
+  constexpr size_t N = input.size();
+
+  auto init = sycl::ext::cplx::cplex::detail::get_init<V, BinaryOperation>();
+
+  auto *d_in = sycl::malloc_device<V>(N, q);
+  auto *d_output = sycl::malloc_device<V>(N, q);
+  auto *d_sg_id = sycl::malloc_device<std::size_t>(N, q);
+
+  auto *h_in = sycl::malloc_host<V>(N, q);
+  auto *h_output = sycl::malloc_host<V>(N, q);
+  auto *h_sg_id = sycl::malloc_host<std::size_t>(N, q);
+
+  for (std::size_t i = 0; i < N; i++) {
+    h_in[i] = input[i];
+  }
+  q.copy(h_in, d_in, N).wait();
+
+  q.submit([&](sycl::handler &cgh) {
+    cgh.parallel_for(sycl::nd_range<1>(N, N), [=](sycl::nd_item<1> it) {
+      auto gid = it.get_global_id(0);
+      auto sg = it.get_sub_group();
+
+      d_output[gid] = sycl::ext::cplx::exclusive_scan_over_group(
+          sg, d_in[gid], init, binary_op);
+      d_sg_id[gid] = sg.get_group_linear_id();
+    });
+  });
+  q.copy(d_output, h_output, N);
+  q.copy(d_sg_id, h_sg_id, N);
+
+  q.wait();
+
+  // Each work-item holds the scan of the preceding work-items of its sub-group
+  for (std::size_t i = 0; i < N; i++) {
+    auto expected = init;
+    for (std::size_t j = 0; j < i; j++) {
+      if (h_sg_id[j] == h_sg_id[i])
+        expected = binary_op(expected, input[j]);
+    }
+
+    check_results(h_output[i], expected);
+    check_zero_parts(h_output[i], expected);
+  }
+
+  sycl::free(d_in, q);
+  sycl::free(d_output, q);
+  sycl::free(d_sg_id, q);
+
+  sycl::free(h_in, q);
+  sycl::free(h_output, q);
+  sycl::free(h_sg_id, q);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // COMPLEX TESTS
 ////////////////////////////////////////////////////////////////////////////////
@@ -80,7 +140,10 @@ TEMPLATE_TEST_CASE_SIG("Test complex exclusive_scan_over_group", "[scan]",
                        ((typename T, std::size_t N, typename BinaryOperation),
                         T, N, BinaryOperation),
                        (double, 4, sycl::plus<>), (float, 4, sycl::plus<>),
-                       (sycl::half, 4, sycl::plus<>)) {
+                       (sycl::half, 4, sycl::plus<>),
+                       (double, 4, sycl::multiplies<>),
+                       (float, 4, sycl::multiplies<>),
+                       (sycl::half, 4, sycl::multiplies<>)) {
 
   using Complex = typename sycl::ext::cplx::complex<T>;
   using Array = typename std::array<Complex, N>;
@@ -114,6 +177,72 @@ TEMPLATE_TEST_CASE_SIG("Test complex exclusive_scan_over_group", "[scan]",
   }
 }
 
+TEMPLATE_TEST_CASE_SIG("Test complex exclusive_scan_over_group with sub-group",
+                       "[scan]",
+                       ((typename T, std::size_t N, typename BinaryOperation),
+                        T, N, BinaryOperation),
+                       (double, 4, sycl::plus<>), (float, 4, sycl::plus<>),
+                       (sycl::half, 4, sycl::plus<>),
+                       (double, 4, sycl::multiplies<>),
+                       (float, 4, sycl::multiplies<>),
+                       (sycl::half, 4, sycl::multiplies<>)) {
+
+  using Complex = typename sycl::ext::cplx::complex<T>;
+  using Array = typename std::array<Complex, N>;
+
+  sycl::queue q;
+
+  const auto test_cases = GENERATE(
+      // Basic value test
+      Array{Complex{1, 0}, Complex{2, 0}, Complex{3, 0}, Complex{4, 0}},
+      // Random value test
+      Array{Complex{0.5, 0.5}, Complex{1.2, 1.2}, Complex{-2.8, -2.8},
+            Complex{3.7, 3.7}},
+      // Negative value test
+      Array{Complex{-3.0, -3.0}, Complex{2.5, 2.5}, Complex{-1.2, -1.2},
+            Complex{0, 0}},
+      // Edge case value test
+      Array{Complex{nan_val<T>, nan_val<T>}, Complex{inf_val<T>, inf_val<T>},
+            Complex{nan_val<T>, inf_val<T>}, Complex{inf_val<T>, nan_val<T>}});
+  const auto binary_op = BinaryOperation{};
+
+  if (is_type_supported<T>(q)) {
+    test_exclusive_scan_over_sub_group(q, test_cases, binary_op);
+  }
+}
+
+TEMPLATE_TEST_CASE("Test complex exclusive_scan_over_group with many factors",
+                   "[scan]", double, float, sycl::half) {
+  using T = TestType;
+  using Complex = typename sycl::ext::cplx::complex<T>;
+  using Array = typename std::array<Complex, 32>;
+
+  sycl::queue q;
+
+  // Factors of magnitude near one with phases spread over all quadrants, then
+  // real and imaginary factors of mixed signs
+  const auto kind = GENERATE(0, 1, 2);
+
+  Array input;
+  for (std::size_t i = 0; i < input.size(); i++) {
+    double rho = 0.875 + 0.03125 * (i % 9);
+    double theta = 0.3 + 1.7 * i;
+    double sign = i % 3 == 0 ? -1 : 1;
+
+    if (kind == 0)
+      input[i] = Complex(T(rho * std::cos(theta)), T(rho * std::sin(theta)));
+    else if (kind == 1)
+      input[i] = Complex(T(sign * rho), T(0));
+    else
+      input[i] = Complex(T(0), T(sign * rho));
+  }
+
+  if (is_type_supported<T>(q)) {
+    test_exclusive_scan_over_group(q, input, sycl::multiplies<>());
+    test_exclusive_scan_over_sub_group(q, input, sycl::multiplies<>());
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // MARRAY<COMPLEX> TESTS
 ////////////////////////////////////////////////////////////////////////////////
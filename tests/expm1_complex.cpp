@@ -0,0 +1,157 @@
+#include "test_helper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPLEX TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE("Test complex expm1", "[expm1]", double, float,
+                   sycl::half) {
+  using T = TestType;
+
+  sycl::queue Q;
+
+  // Test cases
+  cmplx<T> input = GENERATE(
+      cmplx<T>{4.42, 2.02}, cmplx<T>{-1.25, 0}, cmplx<T>{inf_val<T>, 2.02},
+      cmplx<T>{-inf_val<T>, 2.02}, cmplx<T>{4.42, inf_val<T>},
+      cmplx<T>{inf_val<T>, inf_val<T>}, cmplx<T>{nan_val<T>, 2.02},
+      cmplx<T>{4.42, nan_val<T>}, cmplx<T>{nan_val<T>, nan_val<T>},
+      cmplx<T>{nan_val<T>, inf_val<T>}, cmplx<T>{inf_val<T>, nan_val<T>});
+
+  auto std_in = init_std_complex(input);
+  sycl::ext::cplx::complex<T> cplx_input{input.re, input.im};
+
+  std::complex<T> std_out{};
+  sycl::ext::cplx::complex<T> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<sycl::ext::cplx::complex<T>>(1, Q);
+
+  // Get std::complex output
+  auto std_exp = std::exp(std_in);
+  std_out = std_exp - decltype(std_exp)(1);
+
+  // Check cplx::complex output from device
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = sycl::ext::cplx::expm1<T>(cplx_input);
+     }).wait();
+    Q.copy(d_cplx_out, &h_cplx_out, 1).wait();
+
+    check_results(h_cplx_out, std_out);
+  }
+
+  // Check cplx::complex output from host
+  h_cplx_out = sycl::ext::cplx::expm1<T>(cplx_input);
+
+  check_results(h_cplx_out, std_out);
+
+  sycl::free(d_cplx_out, Q);
+}
+
+TEMPLATE_TEST_CASE("Test complex expm1 accuracy", "[expm1]", double, float,
+                   sycl::half) {
+  using T = TestType;
+  using std_T = std::conditional_t<std::is_same_v<T, sycl::half>, float, T>;
+
+  sycl::queue Q;
+
+  // For small |z|, the real part of exp(z) - 1 cancels
+  const std_T t = std::ldexp(std_T(1), std::is_same_v<T, double>  ? -30
+                                       : std::is_same_v<T, float> ? -15
+                                                                  : -7);
+  cmplx<T> input = GENERATE_COPY(
+      cmplx<T>{T(t), T(2 * t)}, cmplx<T>{T(-3 * t), T(t)},
+      cmplx<T>{T(t), T(-t / 4)}, cmplx<T>{T(0.5), T(0.25)},
+      cmplx<T>{T(-0.75), T(1.5)}, cmplx<T>{T(0.125), T(-3)});
+
+  // Reference in long double, through the same identity
+  const long double x = std_T(input.re), y = std_T(input.im);
+  const long double h = std::sin(y / 2);
+  std::complex<T> std_out{
+      T(std_T(std::expm1(x) * std::cos(y) - 2 * h * h)),
+      T(std_T(std::exp(x) * std::sin(y)))};
+
+  sycl::ext::cplx::complex<T> cplx_input{input.re, input.im};
+
+  sycl::ext::cplx::complex<T> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<sycl::ext::cplx::complex<T>>(1, Q);
+
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = sycl::ext::cplx::expm1(cplx_input);
+     }).wait();
+    Q.copy(d_cplx_out, &h_cplx_out, 1).wait();
+    check_results(h_cplx_out.real(), std_out.real());
+    check_results(h_cplx_out.imag(), std_out.imag());
+  }
+
+  h_cplx_out = sycl::ext::cplx::expm1(cplx_input);
+
+  check_results(h_cplx_out.real(), std_out.real());
+  check_results(h_cplx_out.imag(), std_out.imag());
+
+  sycl::free(d_cplx_out, Q);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// MARRAY<COMPLEX> TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE_SIG("Test marray complex expm1", "[expm1]",
+                       ((typename T, std::size_t NumElements), T, NumElements),
+                       (double, 14), (float, 14), (sycl::half, 14)) {
+  sycl::queue Q;
+
+  // std::complex test cases
+  const auto std_in =
+      GENERATE(init_std_complex(sycl::marray<std::complex<T>, NumElements>{
+          std::complex<T>{1.0, 1.0},
+          std::complex<T>{4.42, 2.02},
+          std::complex<T>{-3, 3.5},
+          std::complex<T>{4.0, -4.0},
+          std::complex<T>{2.02, inf_val<T>},
+          std::complex<T>{inf_val<T>, 4.42},
+          std::complex<T>{inf_val<T>, nan_val<T>},
+          std::complex<T>{2.02, 4.42},
+          std::complex<T>{nan_val<T>, nan_val<T>},
+          std::complex<T>{nan_val<T>, nan_val<T>},
+          std::complex<T>{inf_val<T>, inf_val<T>},
+          std::complex<T>{nan_val<T>, nan_val<T>},
+          std::complex<T>{inf_val<T>, inf_val<T>},
+          std::complex<T>{nan_val<T>, nan_val<T>},
+      }));
+
+  // sycl::complex test cases
+  sycl::marray<sycl::ext::cplx::complex<T>, NumElements> cplx_input;
+  for (std::size_t i = 0; i < NumElements; ++i) {
+    cplx_input[i] =
+        sycl::ext::cplx::complex<T>{std_in[i].real(), std_in[i].imag()};
+  }
+
+  sycl::marray<std::complex<T>, NumElements> std_out{};
+  sycl::marray<sycl::ext::cplx::complex<T>, NumElements> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<
+      sycl::marray<sycl::ext::cplx::complex<T>, NumElements>>(1, Q);
+
+  // Get std::complex output
+  for (std::size_t i = 0; i < NumElements; ++i) {
+    auto std_exp = std::exp(std_in[i]);
+    std_out[i] = std_exp - decltype(std_exp)(1);
+  }
+
+  // Check cplx::complex output from device
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = sycl::ext::cplx::expm1<T>(cplx_input);
+     }).wait();
+    Q.copy(d_cplx_out, &h_cplx_out, 1).wait();
+
+    check_results(h_cplx_out, std_out);
+  }
+
+  // Check cplx::complex output from host
+  h_cplx_out = sycl::ext::cplx::expm1<T>(cplx_input);
+
+  check_results(h_cplx_out, std_out);
+
+  sycl::free(d_cplx_out, Q);
+}
@@ -0,0 +1,73 @@
+#include <cmath>
+#include <vector>
+
+#include "test_helper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// UTILITY FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+/// Host reference: first element of largest |re| + |im|, first NaN if any
+template <typename T> std::size_t reference_iamax(const std::vector<T> &x) {
+  std::size_t best = x.size();
+  double best_key = -1;
+  for (std::size_t i = 0; i < x.size(); i++) {
+    double key = std::abs(double(x[i].real())) + std::abs(double(x[i].imag()));
+    if (std::isnan(key))
+      return i;
+    if (key > best_key) {
+      best = i;
+      best_key = key;
+    }
+  }
+  return best;
+}
+
+template <typename T>
+void test_iamax(sycl::queue q, const std::vector<T> &input) {
+  const std::size_t N = input.size();
+
+  auto *d_in = sycl::malloc_device<T>(N, q);
+  q.copy(input.data(), d_in, N).wait();
+
+  const auto output = sycl::ext::cplx::iamax(q, d_in, N);
+
+  const std::size_t expected = reference_iamax(input);
+
+  CHECK(output.index == expected);
+  check_results(output.value, input[expected]);
+
+  sycl::free(d_in, q);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPLEX TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE("Test complex iamax", "[iamax]", double, float,
+                   sycl::half) {
+  using T = TestType;
+  using Complex = typename sycl::ext::cplx::complex<T>;
+
+  sycl::queue q;
+
+  // Sizes below, at and above one work-group, and spanning many work-groups
+  const auto N = GENERATE(1, 7, 64, 1000, 4099);
+
+  // Position of the largest element, or of a NaN; the others tie often
+  const auto special = GENERATE(0, 5, 999, 4098);
+  const auto special_value = GENERATE(Complex{-6, 1}, Complex{1, 6},
+                                      Complex{2, nan_val<T>});
+
+  std::vector<Complex> input(N);
+  for (std::size_t i = 0; i < input.size(); i++)
+    input[i] = Complex{T(int(i % 7) - 3), T(int(i % 5) - 2)};
+
+  if (special < N) {
+    input[special] = special_value;
+  }
+
+  if (is_type_supported<T>(q)) {
+    test_iamax(q, input);
+  }
+}
@@ -0,0 +1,129 @@
+#include <numeric>
+#include <vector>
+
+#include "test_helper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// UTILITY FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T, typename BinaryOperation>
+void test_inclusive_scan(
+    sycl::queue q, const std::vector<T> &input, BinaryOperation binary_op,
+    T init = sycl::ext::cplx::cplex::detail::get_init<T, BinaryOperation>()) {
+  const std::size_t N = input.size();
+
+  auto *d_in = sycl::malloc_device<T>(N, q);
+  auto *d_output_with_init = sycl::malloc_device<T>(N, q);
+  auto *d_output_without_init = sycl::malloc_device<T>(N, q);
+
+  q.copy(input.data(), d_in, N).wait();
+
+  auto *end_with_init = sycl::ext::cplx::inclusive_scan(
+      q, d_in, d_output_with_init, N, binary_op, init);
+  auto *end_without_init = sycl::ext::cplx::inclusive_scan(
+      q, d_in, d_output_without_init, N, binary_op);
+
+  CHECK(end_with_init == d_output_with_init + N);
+  CHECK(end_without_init == d_output_without_init + N);
+
+  std::vector<T> output_with_init(N);
+  std::vector<T> output_without_init(N);
+  q.copy(d_output_with_init, output_with_init.data(), N);
+  q.copy(d_output_without_init, output_without_init.data(), N);
+  q.wait();
+
+  std::vector<T> expected_with_init(N);
+  std::vector<T> expected_without_init(N);
+  std::inclusive_scan(input.begin(), input.end(), expected_with_init.begin(),
+                      binary_op, init);
+  std::inclusive_scan(input.begin(), input.end(),
+                      expected_without_init.begin(), binary_op);
+
+  for (std::size_t i = 0; i < N; i++) {
+    check_results(output_with_init[i], expected_with_init[i]);
+    check_results(output_without_init[i], expected_without_init[i]);
+  }
+
+  sycl::free(d_in, q);
+  sycl::free(d_output_with_init, q);
+  sycl::free(d_output_without_init, q);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPLEX TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE_SIG("Test complex inclusive_scan", "[scan]",
+                       ((typename T, typename BinaryOperation), T,
+                        BinaryOperation),
+                       (double, sycl::plus<>), (float, sycl::plus<>),
+                       (sycl::half, sycl::plus<>),
+                       (double, sycl::multiplies<>),
+                       (float, sycl::multiplies<>),
+                       (sycl::half, sycl::multiplies<>)) {
+
+  using Complex = typename sycl::ext::cplx::complex<T>;
+
+  sycl::queue q;
+
+  // Sizes below, at and above one tile, and spanning many tiles
+  const auto N = GENERATE(1, 7, 64, 1000, 4099);
+
+  // The values are chosen so that every partial sum or product is exact
+  std::vector<Complex> input(N);
+  for (std::size_t i = 0; i < input.size(); i++) {
+    if constexpr (sycl::ext::cplx::cplex::detail::is_plus_v<BinaryOperation>) {
+      input[i] = Complex{T(int(i % 7) - 3), T(int(i % 5) - 2)};
+    } else {
+      const Complex cycle[] = {Complex{0, 1}, Complex{-1, 0}, Complex{0, -1},
+                               Complex{1, 0}};
+      input[i] = cycle[i % 4];
+    }
+  }
+
+  const auto binary_op = BinaryOperation{};
+
+  if (is_type_supported<T>(q)) {
+    test_inclusive_scan(q, input, binary_op);
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG("Test complex inclusive_scan with init", "[scan]",
+                       ((typename T, typename BinaryOperation), T,
+                        BinaryOperation),
+                       (double, sycl::plus<>), (float, sycl::plus<>),
+                       (sycl::half, sycl::plus<>),
+                       (double, sycl::multiplies<>),
+                       (float, sycl::multiplies<>),
+                       (sycl::half, sycl::multiplies<>)) {
+
+  using Complex = typename sycl::ext::cplx::complex<T>;
+
+  sycl::queue q;
+
+  // init must be applied once, also by the tiles after the first one
+  const auto N = GENERATE(7, 300, 1000, 4099);
+
+  constexpr bool is_plus =
+      sycl::ext::cplx::cplex::detail::is_plus_v<BinaryOperation>;
+  const Complex init = is_plus ? Complex{100, -50} : Complex{0, 2};
+
+  // The values are chosen so that every partial sum or product is exact
+  std::vector<Complex> input(N);
+  for (std::size_t i = 0; i < input.size(); i++) {
+    if constexpr (is_plus) {
+      input[i] = Complex{T(int(i % 7) - 3), T(int(i % 5) - 2)};
+    } else {
+      const Complex cycle[] = {Complex{0, 1}, Complex{-1, 0}, Complex{0, -1},
+                               Complex{1, 0}};
+      input[i] = cycle[i % 4];
+    }
+  }
+
+  const auto binary_op = BinaryOperation{};
+
+  if (is_type_supported<T>(q)) {
+    test_inclusive_scan(q, input, binary_op, init);
+  }
+}
@@ -0,0 +1,93 @@
+#include <numeric>
+#include <vector>
+
+#include "test_helper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// UTILITY FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+void test_joint_dot(sycl::queue q, const std::vector<T> &x,
+                    const std::vector<T> &y, std::size_t local_size) {
+  const std::size_t N = x.size();
+
+  const T init{1, -1};
+
+  auto *d_x = sycl::malloc_device<T>(N, q);
+  auto *d_y = sycl::malloc_device<T>(N, q);
+  auto *d_output = sycl::malloc_device<T>(4, q);
+
+  q.copy(x.data(), d_x, N);
+  q.copy(y.data(), d_y, N);
+  q.wait();
+
+  // A single work-group, which may be smaller than the input
+  sycl::nd_range<1> ndr(local_size, local_size);
+
+  q.submit([&](sycl::handler &cgh) {
+    cgh.parallel_for(ndr, [=](sycl::nd_item<1> it) {
+      auto g = it.get_group();
+
+      const T *x = d_x;
+
+      auto dotu_with_init =
+          sycl::ext::cplx::joint_dotu(g, x, x + N, d_y, init);
+      auto dotu_without_init = sycl::ext::cplx::joint_dotu(g, x, x + N, d_y);
+      auto dotc_with_init =
+          sycl::ext::cplx::joint_dotc(g, x, x + N, d_y, init);
+      auto dotc_without_init = sycl::ext::cplx::joint_dotc(g, x, x + N, d_y);
+
+      if (g.leader()) {
+        d_output[0] = dotu_with_init;
+        d_output[1] = dotu_without_init;
+        d_output[2] = dotc_with_init;
+        d_output[3] = dotc_without_init;
+      }
+    });
+  });
+
+  std::vector<T> output(4);
+  q.copy(d_output, output.data(), 4).wait();
+
+  const auto expected_dotu =
+      std::inner_product(x.begin(), x.end(), y.begin(), T{});
+  const auto expected_dotc = std::inner_product(
+      x.begin(), x.end(), y.begin(), T{}, std::plus<>(),
+      [](T a, T b) { return sycl::ext::cplx::conj(a) * b; });
+
+  check_results(output[0], init + expected_dotu);
+  check_results(output[1], expected_dotu);
+  check_results(output[2], init + expected_dotc);
+  check_results(output[3], expected_dotc);
+
+  sycl::free(d_x, q);
+  sycl::free(d_y, q);
+  sycl::free(d_output, q);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPLEX TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE("Test complex joint_dotu and joint_dotc", "[joint_dot]",
+                   double, float, sycl::half) {
+  using T = TestType;
+  using Complex = typename sycl::ext::cplx::complex<T>;
+
+  sycl::queue q;
+
+  const auto N = GENERATE(1, 4, 37);
+  const auto local_size = GENERATE(1, 3, 4, 8, 64);
+
+  // Small integers, so that every product and partial sum is exact
+  std::vector<Complex> x(N), y(N);
+  for (std::size_t i = 0; i < x.size(); i++) {
+    x[i] = Complex{T(int(i % 5) - 2), T(int(i % 3) - 1)};
+    y[i] = Complex{T(int(i % 3) - 1), T(int(i % 4) - 2)};
+  }
+
+  if (is_type_supported<T>(q)) {
+    test_joint_dot(q, x, y, local_size);
+  }
+}
@@ -0,0 +1,94 @@
+#include <cmath>
+#include <vector>
+
+#include "test_helper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// UTILITY FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+/// Host reference: first element of largest |re| + |im|, first NaN if any
+template <typename T> std::size_t reference_iamax(const std::vector<T> &x) {
+  std::size_t best = x.size();
+  double best_key = -1;
+  for (std::size_t i = 0; i < x.size(); i++) {
+    double key = std::abs(double(x[i].real())) + std::abs(double(x[i].imag()));
+    if (std::isnan(key))
+      return i;
+    if (key > best_key) {
+      best = i;
+      best_key = key;
+    }
+  }
+  return best;
+}
+
+template <typename T>
+void test_joint_iamax(sycl::queue q, const std::vector<T> &input,
+                      std::size_t local_size) {
+  const std::size_t N = input.size();
+
+  auto *d_in = sycl::malloc_device<T>(N + 1, q);
+  auto *d_output = sycl::malloc_device<sycl::ext::cplx::iamax_result<T>>(1, q);
+
+  q.copy(input.data(), d_in, N).wait();
+
+  // A single work-group, which may be smaller than the input
+  sycl::nd_range<1> ndr(local_size, local_size);
+
+  q.submit([&](sycl::handler &cgh) {
+    cgh.parallel_for(ndr, [=](sycl::nd_item<1> it) {
+      auto g = it.get_group();
+
+      const T *in = d_in;
+
+      auto result = sycl::ext::cplx::joint_iamax(g, in, in + N);
+      if (g.leader())
+        *d_output = result;
+    });
+  });
+
+  sycl::ext::cplx::iamax_result<T> output;
+  q.copy(d_output, &output, 1).wait();
+
+  const std::size_t expected = reference_iamax(input);
+
+  CHECK(output.index == expected);
+  if (expected < N)
+    check_results(output.value, input[expected]);
+
+  sycl::free(d_in, q);
+  sycl::free(d_output, q);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPLEX TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE("Test complex joint_iamax", "[joint_iamax]", double, float,
+                   sycl::half) {
+  using T = TestType;
+  using Complex = typename sycl::ext::cplx::complex<T>;
+
+  sycl::queue q;
+
+  const auto N = GENERATE(0, 1, 4, 37);
+  const auto local_size = GENERATE(1, 3, 8, 64);
+
+  // Position of the largest element, or of a NaN; the others tie often
+  const auto special = GENERATE(0, 5, 36);
+  const auto special_value = GENERATE(Complex{-6, 1}, Complex{1, 6},
+                                      Complex{2, nan_val<T>});
+
+  std::vector<Complex> input(N);
+  for (std::size_t i = 0; i < input.size(); i++)
+    input[i] = Complex{T(int(i % 7) - 3), T(int(i % 5) - 2)};
+
+  if (special < N) {
+    input[special] = special_value;
+  }
+
+  if (is_type_supported<T>(q)) {
+    test_joint_iamax(q, input, local_size);
+  }
+}
@@ -9,7 +9,8 @@
 
 template <typename T, typename BinaryOperation>
 void test_joint_inclusive_scan(sycl::queue q, T input,
-                               BinaryOperation binary_op) {
+                               BinaryOperation binary_op,
+                               std::size_t local_size = std::tuple_size_v<T>) {
   using V = typename T::value_type;
 
   constexpr size_t N = input.size();
@@ -29,8 +30,11 @@ void test_joint_inclusive_scan(sycl::queue q, T input,
   }
   q.copy(h_in, d_in, N).wait();
 
+  // A single work-group, which may be smaller than the input
+  sycl::nd_range<1> ndr(local_size, local_size);
+
   q.submit([&](sycl::handler &cgh) {
-    cgh.parallel_for(sycl::nd_range<1>(N, N), [=](sycl::nd_item<1> it) {
+    cgh.parallel_for(ndr, [=](sycl::nd_item<1> it) {
       auto gid = it.get_global_id(0);
       auto lid = it.get_local_id(0);
       auto g = it.get_group();
@@ -41,8 +45,8 @@ void test_joint_inclusive_scan(sycl::queue q, T input,
                                             d_output_without_init, binary_op);
     });
   });
-  q.copy(h_output_with_init, d_output_with_init, N);
-  q.copy(h_output_without_init, d_output_without_init, N);
+  q.copy(d_output_with_init, h_output_with_init, N);
+  q.copy(d_output_without_init, h_output_without_init, N);
 
   q.wait();
 
@@ -71,6 +75,86 @@ void test_joint_inclusive_scan(sycl::queue q, T input,
   sycl::free(h_output_without_init, q);
 }
 
+template <typename T, typename BinaryOperation>
+void test_joint_inclusive_scan_over_sub_group(sycl::queue q, T input,
+                                              BinaryOperation binary_op,
+                                              std::size_t local_size) {
+  using V = typename T::value_type;
+
+  constexpr size_t N = input.size();
+
+  auto init = sycl::ext::cplx::cplex::detail::get_init<V, BinaryOperation>();
+
+  // One output slice per sub-group, and there are at most local_size of them
+  auto *d_in = sycl::malloc_device<V>(N, q);
+  auto *d_output_with_init = sycl::malloc_device<V>(N * local_size, q);
+  auto *d_output_without_init = sycl::malloc_device<V>(N * local_size, q);
+  auto *d_num_sg = sycl::malloc_device<std::size_t>(1, q);
+
+  auto *h_in = sycl::malloc_host<V>(N, q);
+  auto *h_output_with_init = sycl::malloc_host<V>(N * local_size, q);
+  auto *h_output_without_init = sycl::malloc_host<V>(N * local_size, q);
+  auto *h_num_sg = sycl::malloc_host<std::size_t>(1, q);
+
+  for (std::size_t i = 0; i < N; i++) {
+    h_in[i] = input[i];
+  }
+  q.copy(h_in, d_in, N).wait();
+
+  // Each sub-group of a single work-group scans the whole input
+  sycl::nd_range<1> ndr(local_size, local_size);
+
+  q.submit([&](sycl::handler &cgh) {
+    cgh.parallel_for(ndr, [=](sycl::nd_item<1> it) {
+      auto sg = it.get_sub_group();
+      auto offset = sg.get_group_linear_id() * N;
+
+      sycl::ext::cplx::joint_inclusive_scan(sg, d_in, d_in + N,
+                                            d_output_with_init + offset,
+                                            binary_op, init);
+      sycl::ext::cplx::joint_inclusive_scan(sg, d_in, d_in + N,
+                                            d_output_without_init + offset,
+                                            binary_op);
+
+      if (it.get_local_linear_id() == 0)
+        *d_num_sg = sg.get_group_linear_range();
+    });
+  });
+  q.copy(d_output_with_init, h_output_with_init, N * local_size);
+  q.copy(d_output_without_init, h_output_without_init, N * local_size);
+  q.copy(d_num_sg, h_num_sg, 1);
+
+  q.wait();
+
+  std::array<V, N> expected;
+  std::inclusive_scan(input.begin(), input.end(), expected.begin(), binary_op);
+
+  for (std::size_t sg_id = 0; sg_id < *h_num_sg; sg_id++) {
+    std::array<V, N> result;
+    for (std::size_t i = 0; i < N; i++) {
+      result[i] = h_output_with_init[sg_id * N + i];
+    }
+
+    check_results(result, expected);
+
+    for (std::size_t i = 0; i < N; i++) {
+      result[i] = h_output_without_init[sg_id * N + i];
+    }
+
+    check_results(result, expected);
+  }
+
+  sycl::free(d_in, q);
+  sycl::free(d_output_with_init, q);
+  sycl::free(d_output_without_init, q);
+  sycl::free(d_num_sg, q);
+
+  sycl::free(h_in, q);
+  sycl::free(h_output_with_init, q);
+  sycl::free(h_output_without_init, q);
+  sycl::free(h_num_sg, q);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // COMPLEX TESTS
 ////////////////////////////////////////////////////////////////////////////////
@@ -113,6 +197,61 @@ TEMPLATE_TEST_CASE_SIG("Test complex joint_inclusive_scan", "[scan]",
   }
 }
 
+TEMPLATE_TEST_CASE_SIG("Test complex joint_inclusive_scan with more elements "
+                       "than work-items",
+                       "[scan]",
+                       ((typename T, std::size_t N, typename BinaryOperation),
+                        T, N, BinaryOperation),
+                       (double, 37, sycl::plus<>), (float, 37, sycl::plus<>),
+                       (sycl::half, 37, sycl::plus<>),
+                       (double, 37, sycl::multiplies<>),
+                       (float, 37, sycl::multiplies<>)) {
+
+  using Complex = typename sycl::ext::cplx::complex<T>;
+  using Array = typename std::array<Complex, N>;
+
+  sycl::queue q;
+
+  Array input;
+  for (std::size_t i = 0; i < N; i++) {
+    input[i] = Complex{T(0.5 + 0.0625 * (i % 7)), T(0.125 * (i % 5) - 0.25)};
+  }
+
+  // Work-group sizes with full, partial and empty tiles
+  const auto local_size = GENERATE(1, 3, 4, 8, 64);
+  const auto binary_op = BinaryOperation{};
+
+  if (is_type_supported<T>(q)) {
+    test_joint_inclusive_scan(q, input, binary_op, local_size);
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG("Test complex joint_inclusive_scan with sub-group",
+                       "[scan]",
+                       ((typename T, std::size_t N, typename BinaryOperation),
+                        T, N, BinaryOperation),
+                       (double, 37, sycl::plus<>), (float, 37, sycl::plus<>),
+                       (double, 37, sycl::multiplies<>),
+                       (float, 37, sycl::multiplies<>)) {
+
+  using Complex = typename sycl::ext::cplx::complex<T>;
+  using Array = typename std::array<Complex, N>;
+
+  sycl::queue q;
+
+  Array input;
+  for (std::size_t i = 0; i < N; i++) {
+    input[i] = Complex{T(0.5 + 0.0625 * (i % 7)), T(0.125 * (i % 5) - 0.25)};
+  }
+
+  const auto local_size = GENERATE(1, 3, 4, 8);
+  const auto binary_op = BinaryOperation{};
+
+  if (is_type_supported<T>(q)) {
+    test_joint_inclusive_scan_over_sub_group(q, input, binary_op, local_size);
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // MARRAY<COMPLEX> TESTS
 ////////////////////////////////////////////////////////////////////////////////
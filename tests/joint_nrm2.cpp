@@ -0,0 +1,104 @@
+#include <cmath>
+#include <vector>
+
+#include "test_helper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// UTILITY FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+void test_joint_nrm2(sycl::queue q, const std::vector<T> &input,
+                     typename T::value_type expected, std::size_t local_size) {
+  using R = typename T::value_type;
+
+  const std::size_t N = input.size();
+
+  auto *d_in = sycl::malloc_device<T>(N, q);
+  auto *d_output = sycl::malloc_device<R>(1, q);
+
+  q.copy(input.data(), d_in, N).wait();
+
+  // A single work-group, which may be smaller than the input
+  sycl::nd_range<1> ndr(local_size, local_size);
+
+  q.submit([&](sycl::handler &cgh) {
+    cgh.parallel_for(ndr, [=](sycl::nd_item<1> it) {
+      auto g = it.get_group();
+
+      auto result = sycl::ext::cplx::joint_nrm2(g, d_in, d_in + N);
+      if (g.leader())
+        *d_output = result;
+    });
+  });
+
+  R output;
+  q.copy(d_output, &output, 1).wait();
+
+  check_results(output, expected);
+
+  sycl::free(d_in, q);
+  sycl::free(d_output, q);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPLEX TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE("Test complex joint_nrm2", "[joint_nrm2]", double, float,
+                   sycl::half) {
+  using T = TestType;
+  using Complex = typename sycl::ext::cplx::complex<T>;
+
+  sycl::queue q;
+
+  const auto N = GENERATE(1, 4, 37);
+  const auto local_size = GENERATE(1, 3, 8, 64);
+
+  // Powers of two whose squares overflow or underflow T; half is accumulated
+  // in float, so for half they are just the ends of its range
+  const auto scale_exponent = GENERATE(0, 1, -1);
+  const int max_exponent = std::is_same_v<T, double>  ? 600
+                           : std::is_same_v<T, float> ? 100
+                                                      : 10;
+
+  // Whether the first element is much bigger than the others
+  const auto outlier = GENERATE(false, true);
+
+  std::vector<Complex> input(N);
+  long double sum_of_squares = 0;
+  for (std::size_t i = 0; i < input.size(); i++) {
+    int exponent = scale_exponent * max_exponent;
+    if (outlier && i == 0)
+      exponent += max_exponent / 2;
+
+    long double re = std::ldexp((long double)(int(i % 7) - 3), exponent);
+    long double im = std::ldexp((long double)(int(i % 5) - 1), exponent);
+
+    input[i] = Complex{T(double(re)), T(double(im))};
+    sum_of_squares += re * re + im * im;
+  }
+
+  const T expected = T(double(std::sqrt(sum_of_squares)));
+
+  if (is_type_supported<T>(q)) {
+    test_joint_nrm2(q, input, expected, local_size);
+  }
+}
+
+TEMPLATE_TEST_CASE("Test complex joint_nrm2 with inf and nan", "[joint_nrm2]",
+                   double, float, sycl::half) {
+  using T = TestType;
+  using Complex = typename sycl::ext::cplx::complex<T>;
+
+  sycl::queue q;
+
+  const auto special = GENERATE(inf_val<T>, nan_val<T>);
+
+  std::vector<Complex> input(37, Complex{1, 1});
+  input[20] = Complex{1, special};
+
+  if (is_type_supported<T>(q)) {
+    test_joint_nrm2(q, input, special, 8);
+  }
+}
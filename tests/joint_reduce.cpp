@@ -1,5 +1,6 @@
 #include <array>
 #include <numeric>
+#include <vector>
 
 #include "test_helper.hpp"
 
@@ -8,7 +9,8 @@
 ////////////////////////////////////////////////////////////////////////////////
 
 template <typename T, typename BinaryOperation>
-void test_joint_reduce(sycl::queue q, T input, BinaryOperation binary_op) {
+void test_joint_reduce(sycl::queue q, T input, BinaryOperation binary_op,
+                       std::size_t local_size = std::tuple_size_v<T>) {
   using V = typename T::value_type;
 
   constexpr size_t N = input.size();
@@ -28,8 +30,11 @@ void test_joint_reduce(sycl::queue q, T input, BinaryOperation binary_op) {
   }
   q.copy(h_in, d_in, N).wait();
 
+  // A single work-group, which may be smaller than the input
+  sycl::nd_range<1> ndr(local_size, local_size);
+
   q.submit([&](sycl::handler &cgh) {
-    cgh.parallel_for(sycl::nd_range<1>(N, N), [=](sycl::nd_item<1> it) {
+    cgh.parallel_for(ndr, [=](sycl::nd_item<1> it) {
       auto gid = it.get_global_id(0);
       auto lid = it.get_local_id(0);
       auto g = it.get_group();
@@ -60,6 +65,117 @@ void test_joint_reduce(sycl::queue q, T input, BinaryOperation binary_op) {
   sycl::free(h_output_without_init, q);
 }
 
+template <typename T, typename BinaryOperation>
+void test_joint_reduce_over_sub_group(sycl::queue q, T input,
+                                      BinaryOperation binary_op,
+                                      std::size_t local_size) {
+  using V = typename T::value_type;
+
+  constexpr size_t N = input.size();
+
+  auto init = sycl::ext::cplx::cplex::detail::get_init<V, BinaryOperation>();
+
+  // One output per sub-group, and there are at most local_size of them
+  auto *d_in = sycl::malloc_device<V>(N, q);
+  auto *d_output_with_init = sycl::malloc_device<V>(local_size, q);
+  auto *d_output_without_init = sycl::malloc_device<V>(local_size, q);
+  auto *d_num_sg = sycl::malloc_device<std::size_t>(1, q);
+
+  auto *h_in = sycl::malloc_host<V>(N, q);
+  auto *h_output_with_init = sycl::malloc_host<V>(local_size, q);
+  auto *h_output_without_init = sycl::malloc_host<V>(local_size, q);
+  auto *h_num_sg = sycl::malloc_host<std::size_t>(1, q);
+
+  for (std::size_t i = 0; i < N; i++) {
+    h_in[i] = input[i];
+  }
+  q.copy(h_in, d_in, N).wait();
+
+  // Each sub-group of a single work-group reduces the whole input
+  sycl::nd_range<1> ndr(local_size, local_size);
+
+  q.submit([&](sycl::handler &cgh) {
+    cgh.parallel_for(ndr, [=](sycl::nd_item<1> it) {
+      auto sg = it.get_sub_group();
+      auto sg_id = sg.get_group_linear_id();
+
+      auto with_init =
+          sycl::ext::cplx::joint_reduce(sg, d_in, d_in + N, init, binary_op);
+      auto without_init =
+          sycl::ext::cplx::joint_reduce(sg, d_in, d_in + N, binary_op);
+
+      if (sg.leader()) {
+        d_output_with_init[sg_id] = with_init;
+        d_output_without_init[sg_id] = without_init;
+      }
+      if (it.get_local_linear_id() == 0)
+        *d_num_sg = sg.get_group_linear_range();
+    });
+  });
+  q.copy(d_output_with_init, h_output_with_init, local_size);
+  q.copy(d_output_without_init, h_output_without_init, local_size);
+  q.copy(d_num_sg, h_num_sg, 1);
+  q.wait();
+
+  const auto expected =
+      std::reduce(input.begin(), input.end(), init, binary_op);
+
+  for (std::size_t i = 0; i < *h_num_sg; i++) {
+    check_results(h_output_with_init[i], expected);
+    check_results(h_output_without_init[i], expected);
+  }
+
+  sycl::free(d_in, q);
+  sycl::free(d_output_with_init, q);
+  sycl::free(d_output_without_init, q);
+  sycl::free(d_num_sg, q);
+
+  sycl::free(h_in, q);
+  sycl::free(h_output_with_init, q);
+  sycl::free(h_output_without_init, q);
+  sycl::free(h_num_sg, q);
+}
+
+template <typename T>
+void test_joint_reduce_compensated(sycl::queue q, const std::vector<T> &input,
+                                   std::size_t local_size) {
+  using R = typename T::value_type;
+
+  const std::size_t N = input.size();
+
+  auto *d_in = sycl::malloc_device<T>(N, q);
+  auto *d_output = sycl::malloc_device<T>(1, q);
+
+  q.copy(input.data(), d_in, N).wait();
+
+  // A single work-group, which may be smaller than the input
+  sycl::nd_range<1> ndr(local_size, local_size);
+
+  q.submit([&](sycl::handler &cgh) {
+    cgh.parallel_for(ndr, [=](sycl::nd_item<1> it) {
+      auto g = it.get_group();
+
+      *d_output = sycl::ext::cplx::joint_reduce(
+          g, d_in, d_in + N, sycl::ext::cplx::compensated_plus());
+    });
+  });
+
+  T output;
+  q.copy(d_output, &output, 1).wait();
+
+  // Reference summed in double and rounded once
+  sycl::ext::cplx::complex<double> sum;
+  for (const auto &x : input) {
+    sum += sycl::ext::cplx::complex<double>(x);
+  }
+  const auto expected = T(R(sum.real()), R(sum.imag()));
+
+  check_results(output, expected);
+
+  sycl::free(d_in, q);
+  sycl::free(d_output, q);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // COMPLEX TESTS
 ////////////////////////////////////////////////////////////////////////////////
@@ -102,6 +218,86 @@ TEMPLATE_TEST_CASE_SIG("Test complex joint_reduce", "[reduction]",
   }
 }
 
+TEMPLATE_TEST_CASE_SIG("Test complex joint_reduce with more elements than "
+                       "work-items",
+                       "[reduction]",
+                       ((typename T, std::size_t N, typename BinaryOperation),
+                        T, N, BinaryOperation),
+                       (double, 37, sycl::plus<>), (float, 37, sycl::plus<>),
+                       (sycl::half, 37, sycl::plus<>),
+                       (double, 37, sycl::multiplies<>),
+                       (float, 37, sycl::multiplies<>)) {
+
+  using Complex = typename sycl::ext::cplx::complex<T>;
+  using Array = typename std::array<Complex, N>;
+
+  sycl::queue q;
+
+  Array input;
+  for (std::size_t i = 0; i < N; i++) {
+    input[i] = Complex{T(0.5 + 0.0625 * (i % 7)), T(0.125 * (i % 5) - 0.25)};
+  }
+
+  // Work-group sizes which exercise the unrolled loop and the tail
+  const auto local_size = GENERATE(1, 3, 4, 8);
+  const auto binary_op = BinaryOperation{};
+
+  if (is_type_supported<T>(q)) {
+    test_joint_reduce(q, input, binary_op, local_size);
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG("Test complex joint_reduce with sub-group",
+                       "[reduction]",
+                       ((typename T, std::size_t N, typename BinaryOperation),
+                        T, N, BinaryOperation),
+                       (double, 37, sycl::plus<>), (float, 37, sycl::plus<>),
+                       (double, 37, sycl::multiplies<>),
+                       (float, 37, sycl::multiplies<>)) {
+
+  using Complex = typename sycl::ext::cplx::complex<T>;
+  using Array = typename std::array<Complex, N>;
+
+  sycl::queue q;
+
+  Array input;
+  for (std::size_t i = 0; i < N; i++) {
+    input[i] = Complex{T(0.5 + 0.0625 * (i % 7)), T(0.125 * (i % 5) - 0.25)};
+  }
+
+  const auto local_size = GENERATE(1, 3, 4, 8);
+  const auto binary_op = BinaryOperation{};
+
+  if (is_type_supported<T>(q)) {
+    test_joint_reduce_over_sub_group(q, input, binary_op, local_size);
+  }
+}
+
+TEMPLATE_TEST_CASE("Test complex joint_reduce with compensated_plus",
+                   "[reduction]", float, sycl::half) {
+
+  using T = TestType;
+  using Complex = typename sycl::ext::cplx::complex<T>;
+
+  sycl::queue q;
+
+  // Every unit added to the leading value is lost by a naive sum: the value
+  // spacing at 2 / epsilon is 2
+  const T big = T(2) / std::numeric_limits<T>::epsilon();
+
+  // The error term is itself summed naively, so it has to stay exact
+  const std::size_t N = std::is_same_v<T, sycl::half> ? 1024 : 4096;
+
+  std::vector<Complex> input(N, Complex{1, -1});
+  input[0] = Complex{big, -big};
+
+  const auto local_size = GENERATE(1, 4, 8);
+
+  if (is_type_supported<T>(q)) {
+    test_joint_reduce_compensated(q, input, local_size);
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // MARRAY<COMPLEX> TESTS
 ////////////////////////////////////////////////////////////////////////////////
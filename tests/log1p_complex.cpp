@@ -0,0 +1,153 @@
+#include "test_helper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPLEX TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE("Test complex log1p", "[log1p]", double, float,
+                   sycl::half) {
+  using T = TestType;
+
+  sycl::queue Q;
+
+  // Test cases
+  cmplx<T> input = GENERATE(
+      cmplx<T>{4.42, 2.02}, cmplx<T>{-1, 0}, cmplx<T>{-3.5, -1.25},
+      cmplx<T>{inf_val<T>, 2.02}, cmplx<T>{4.42, inf_val<T>},
+      cmplx<T>{inf_val<T>, inf_val<T>}, cmplx<T>{nan_val<T>, 2.02},
+      cmplx<T>{4.42, nan_val<T>}, cmplx<T>{nan_val<T>, nan_val<T>},
+      cmplx<T>{nan_val<T>, inf_val<T>}, cmplx<T>{inf_val<T>, nan_val<T>});
+
+  auto std_in = init_std_complex(input);
+  sycl::ext::cplx::complex<T> cplx_input{input.re, input.im};
+
+  std::complex<T> std_out{};
+  sycl::ext::cplx::complex<T> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<sycl::ext::cplx::complex<T>>(1, Q);
+
+  // Get std::complex output
+  std_out = std::log(std_in + decltype(std_in)(1));
+
+  // Check cplx::complex output from device
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = sycl::ext::cplx::log1p<T>(cplx_input);
+     }).wait();
+    Q.copy(d_cplx_out, &h_cplx_out, 1).wait();
+
+    check_results(h_cplx_out, std_out);
+  }
+
+  // Check cplx::complex output from host
+  h_cplx_out = sycl::ext::cplx::log1p<T>(cplx_input);
+
+  check_results(h_cplx_out, std_out);
+
+  sycl::free(d_cplx_out, Q);
+}
+
+TEMPLATE_TEST_CASE("Test complex log1p accuracy", "[log1p]", double, float,
+                   sycl::half) {
+  using T = TestType;
+  using std_T = std::conditional_t<std::is_same_v<T, sycl::half>, float, T>;
+
+  sycl::queue Q;
+
+  // For small |z|, 1 + z rounds away the low bits of z
+  const std_T t = std::ldexp(std_T(1), std::is_same_v<T, double>  ? -30
+                                       : std::is_same_v<T, float> ? -15
+                                                                  : -7);
+  cmplx<T> input = GENERATE_COPY(
+      cmplx<T>{T(1.3 * t), T(2.1 * t)}, cmplx<T>{T(-3.7 * t), T(t)},
+      cmplx<T>{T(1.9 * t), T(-t / 3)}, cmplx<T>{T(0.27), T(-0.36)},
+      cmplx<T>{T(-0.43), T(0.12)}, cmplx<T>{T(3.5), T(-1.25)});
+
+  // Reference in long double
+  const long double x = std_T(input.re), y = std_T(input.im);
+  std::complex<T> std_out{T(std_T(std::log1p(2 * x + x * x + y * y) / 2)),
+                          T(std_T(std::atan2(y, 1 + x)))};
+
+  sycl::ext::cplx::complex<T> cplx_input{input.re, input.im};
+
+  sycl::ext::cplx::complex<T> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<sycl::ext::cplx::complex<T>>(1, Q);
+
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = sycl::ext::cplx::log1p(cplx_input);
+     }).wait();
+    Q.copy(d_cplx_out, &h_cplx_out, 1).wait();
+    check_results(h_cplx_out.real(), std_out.real());
+    check_results(h_cplx_out.imag(), std_out.imag());
+  }
+
+  h_cplx_out = sycl::ext::cplx::log1p(cplx_input);
+
+  check_results(h_cplx_out.real(), std_out.real());
+  check_results(h_cplx_out.imag(), std_out.imag());
+
+  sycl::free(d_cplx_out, Q);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// MARRAY<COMPLEX> TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE_SIG("Test marray complex log1p", "[log1p]",
+                       ((typename T, std::size_t NumElements), T, NumElements),
+                       (double, 14), (float, 14), (sycl::half, 14)) {
+  sycl::queue Q;
+
+  // std::complex test cases
+  const auto std_in =
+      GENERATE(init_std_complex(sycl::marray<std::complex<T>, NumElements>{
+          std::complex<T>{1.0, 1.0},
+          std::complex<T>{4.42, 2.02},
+          std::complex<T>{-3, 3.5},
+          std::complex<T>{4.0, -4.0},
+          std::complex<T>{2.02, inf_val<T>},
+          std::complex<T>{inf_val<T>, 4.42},
+          std::complex<T>{inf_val<T>, nan_val<T>},
+          std::complex<T>{2.02, 4.42},
+          std::complex<T>{nan_val<T>, nan_val<T>},
+          std::complex<T>{nan_val<T>, nan_val<T>},
+          std::complex<T>{inf_val<T>, inf_val<T>},
+          std::complex<T>{nan_val<T>, nan_val<T>},
+          std::complex<T>{inf_val<T>, inf_val<T>},
+          std::complex<T>{nan_val<T>, nan_val<T>},
+      }));
+
+  // sycl::complex test cases
+  sycl::marray<sycl::ext::cplx::complex<T>, NumElements> cplx_input;
+  for (std::size_t i = 0; i < NumElements; ++i) {
+    cplx_input[i] =
+        sycl::ext::cplx::complex<T>{std_in[i].real(), std_in[i].imag()};
+  }
+
+  sycl::marray<std::complex<T>, NumElements> std_out{};
+  sycl::marray<sycl::ext::cplx::complex<T>, NumElements> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<
+      sycl::marray<sycl::ext::cplx::complex<T>, NumElements>>(1, Q);
+
+  // Get std::complex output
+  using std_cplx = typename std::decay_t<decltype(std_in)>::value_type;
+  for (std::size_t i = 0; i < NumElements; ++i)
+    std_out[i] = std::log(std_in[i] + std_cplx(1));
+
+  // Check cplx::complex output from device
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = sycl::ext::cplx::log1p<T>(cplx_input);
+     }).wait();
+    Q.copy(d_cplx_out, &h_cplx_out, 1).wait();
+
+    check_results(h_cplx_out, std_out);
+  }
+
+  // Check cplx::complex output from host
+  h_cplx_out = sycl::ext::cplx::log1p<T>(cplx_input);
+
+  check_results(h_cplx_out, std_out);
+
+  sycl::free(d_cplx_out, Q);
+}
@@ -45,6 +45,71 @@ TEMPLATE_TEST_CASE("Test complex log", "[log]", double, float, sycl::half) {
   sycl::free(d_cplx_out, Q);
 }
 
+TEMPLATE_TEST_CASE("Test complex log_abs accuracy", "[log]", double, float,
+                   sycl::half) {
+  using T = TestType;
+  using std_T = std::conditional_t<std::is_same_v<T, sycl::half>, float, T>;
+  namespace cplx = sycl::ext::cplx;
+
+  sycl::queue Q;
+
+  // Near |z| = 1 the real part of log(z) is small and log(abs(z)) cancels, at
+  // the extremes of the range the norm over- or underflows
+  const std_T t = std::ldexp(std_T(1), std::is_same_v<T, double>  ? -20
+                                       : std::is_same_v<T, float> ? -10
+                                                                  : -5);
+  const std_T big = std_T(std::numeric_limits<T>::max()) / 2;
+  const std_T tiny = std_T(std::numeric_limits<T>::min()) * 4;
+  // At most 26 significant bits, so that the squares and their sum are exact
+  // in long double
+  auto short_mantissa = [](double x) {
+    int e;
+    std::frexp(x, &e);
+    return std::ldexp(std::round(std::ldexp(x, 26 - e)), e - 26);
+  };
+  cmplx<T> input = GENERATE_COPY(
+      cmplx<T>{T(1 + t), T(t)}, cmplx<T>{T(-t), T(1 - t)},
+      cmplx<T>{T(short_mantissa(0.6)), T(short_mantissa(0.8 + t))},
+      cmplx<T>{T(big), T(-big)}, cmplx<T>{T(tiny), T(tiny)},
+      cmplx<T>{T(-4.42), T(2.02)});
+
+  // Reference in long double, through log1p near |z| = 1
+  const long double a = std_T(input.re), b = std_T(input.im);
+  const long double aa = a * a, bb = b * b;
+  const long double ref = (aa + bb >= 0.25L && aa + bb <= 4)
+                              ? std::log1p((aa - 1) + bb) / 2
+                              : std::log(aa + bb) / 2;
+  T std_log_abs = T(std_T(ref));
+  T std_arg = T(std_T(std::atan2(b, a)));
+
+  cplx::complex<T> cplx_input{input.re, input.im};
+
+  T h_cplx_out[3];
+  auto d_cplx_out = sycl::malloc_device<T>(3, Q);
+
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = cplx::log_abs(cplx_input);
+       d_cplx_out[1] = cplx::log_abs_arg(cplx_input, &d_cplx_out[2]);
+     }).wait();
+    Q.copy(d_cplx_out, h_cplx_out, 3).wait();
+    check_results(h_cplx_out[0], std_log_abs);
+    check_results(h_cplx_out[1], std_log_abs);
+    check_results(h_cplx_out[2], std_arg);
+  }
+
+  h_cplx_out[0] = cplx::log_abs(cplx_input);
+  h_cplx_out[1] = cplx::log_abs_arg(cplx_input, &h_cplx_out[2]);
+  check_results(h_cplx_out[0], std_log_abs);
+  check_results(h_cplx_out[1], std_log_abs);
+  check_results(h_cplx_out[2], std_arg);
+
+  // The real part of log is the same value
+  check_results(cplx::log(cplx_input).real(), std_log_abs);
+
+  sycl::free(d_cplx_out, Q);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // MARRAY<COMPLEX> TESTS
 ////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,62 @@
+#include <cmath>
+#include <vector>
+
+#include "test_helper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// UTILITY FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T>
+void test_nrm2(sycl::queue q, const std::vector<T> &input,
+               typename T::value_type expected) {
+  const std::size_t N = input.size();
+
+  auto *d_in = sycl::malloc_device<T>(N, q);
+  q.copy(input.data(), d_in, N).wait();
+
+  const auto output = sycl::ext::cplx::nrm2(q, d_in, N);
+
+  check_results(output, expected);
+
+  sycl::free(d_in, q);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPLEX TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE("Test complex nrm2", "[nrm2]", double, float, sycl::half) {
+  using T = TestType;
+  using Complex = typename sycl::ext::cplx::complex<T>;
+
+  sycl::queue q;
+
+  // Sizes below, at and above one work-group, and spanning many work-groups
+  const auto N = GENERATE(1, 7, 64, 1000, 4099);
+
+  // Powers of two whose squares overflow or underflow T; half is accumulated
+  // in float, so for half they are just the ends of its range
+  const auto scale_exponent = GENERATE(0, 1, -1);
+  const int max_exponent = std::is_same_v<T, double>  ? 600
+                           : std::is_same_v<T, float> ? 100
+                                                      : 10;
+
+  std::vector<Complex> input(N);
+  long double sum_of_squares = 0;
+  for (std::size_t i = 0; i < input.size(); i++) {
+    int exponent = scale_exponent * max_exponent;
+
+    long double re = std::ldexp((long double)(int(i % 7) - 3), exponent);
+    long double im = std::ldexp((long double)(int(i % 5) - 1), exponent);
+
+    input[i] = Complex{T(double(re)), T(double(im))};
+    sum_of_squares += re * re + im * im;
+  }
+
+  const T expected = T(double(std::sqrt(sum_of_squares)));
+
+  if (is_type_supported<T>(q)) {
+    test_nrm2(q, input, expected);
+  }
+}
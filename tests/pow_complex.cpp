@@ -185,6 +185,54 @@ TEMPLATE_TEST_CASE("Test complex pow cplx-deci overload", "[pow]", double,
   sycl::free(d_cplx_out, Q);
 }
 
+TEMPLATE_TEST_CASE("Test complex pow cplx-deci accuracy", "[pow]", double,
+                   float, sycl::half) {
+  using T = TestType;
+  using std_T = std::conditional_t<std::is_same_v<T, sycl::half>, float, T>;
+
+  sycl::queue Q;
+
+  // Test cases
+  // Values are generated as cross product of input1 and input2's GENERATE list
+  cmplx<T> input1 = GENERATE(cmplx<T>{1.25, 0.5}, cmplx<T>{-0.75, 1.125},
+                             cmplx<T>{0, -1.5}, cmplx<T>{-1, 0},
+                             cmplx<T>{4, 0}, cmplx<T>{0.5, -0.});
+  T input2 = GENERATE(T(0.5), T(-0.5), T(1.75), T(-2.25), T(3), T(0));
+
+  // Reference in extended precision
+  auto reference = std::pow(
+      std::complex<long double>(std_T(input1.re), std_T(input1.im)),
+      static_cast<long double>(std_T(input2)));
+  std::complex<T> std_out = init_std_complex(
+      cmplx<T>{T(std_T(reference.real())), T(std_T(reference.imag()))});
+
+  sycl::ext::cplx::complex<T> cplx_input1{input1.re, input1.im};
+
+  sycl::ext::cplx::complex<T> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<sycl::ext::cplx::complex<T>>(1, Q);
+
+  // Check cplx::complex output from device
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = sycl::ext::cplx::pow<T>(cplx_input1, input2);
+     }).wait();
+    Q.copy(d_cplx_out, &h_cplx_out, 1).wait();
+
+    check_results(h_cplx_out, std_out);
+  }
+
+  // Check cplx::complex output from host
+  h_cplx_out = sycl::ext::cplx::pow<T>(cplx_input1, input2);
+
+  check_results(h_cplx_out, std_out);
+
+  // Real positive bases keep the sign of their zero imaginary part
+  if (input1.im == T(0) && input1.re > T(0))
+    CHECK(std::signbit(h_cplx_out.imag()) == std::signbit(input1.im));
+
+  sycl::free(d_cplx_out, Q);
+}
+
 TEMPLATE_TEST_CASE("Test complex pow deci-cplx overload", "[pow]", double,
                    float, sycl::half) {
   using T = TestType;
@@ -232,6 +280,114 @@ TEMPLATE_TEST_CASE("Test complex pow deci-cplx overload", "[pow]", double,
   sycl::free(d_cplx_out, Q);
 }
 
+TEMPLATE_TEST_CASE("Test complex pow cplx-int overload", "[pow]", double,
+                   float, sycl::half) {
+  using T = TestType;
+  using std_T = std::conditional_t<std::is_same_v<T, sycl::half>, float, T>;
+
+  sycl::queue Q;
+
+  // Test cases
+  // Values are generated as cross product of input1 and input2's GENERATE list
+  cmplx<T> input1 = GENERATE(cmplx<T>{1.25, 0.5}, cmplx<T>{-0.75, 1.125},
+                             cmplx<T>{0, -1.5}, cmplx<T>{-1, 0});
+  int input2 = GENERATE(-3, -2, -1, 0, 1, 2, 3, 5, 8, 13);
+
+  // Reference in extended precision
+  auto reference = std::pow(
+      std::complex<long double>(std_T(input1.re), std_T(input1.im)),
+      static_cast<long double>(input2));
+  std::complex<T> std_out = init_std_complex(
+      cmplx<T>{T(std_T(reference.real())), T(std_T(reference.imag()))});
+
+  sycl::ext::cplx::complex<T> cplx_input1{input1.re, input1.im};
+  sycl::ext::cplx::complex<T> cplx_input2{T(input2), T(0)};
+
+  sycl::ext::cplx::complex<T> h_cplx_out[3];
+  auto d_cplx_out = sycl::malloc_device<sycl::ext::cplx::complex<T>>(3, Q);
+
+  // Integer overload, and integral exponents detected at run time
+  auto apply = [=](auto *out) {
+    out[0] = sycl::ext::cplx::pow<T>(cplx_input1, input2);
+    out[1] = sycl::ext::cplx::pow<T>(cplx_input1, T(input2));
+    out[2] = sycl::ext::cplx::pow<T>(cplx_input1, cplx_input2);
+  };
+
+  // Check cplx::complex output from device
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() { apply(d_cplx_out); }).wait();
+    Q.copy(d_cplx_out, h_cplx_out, 3).wait();
+
+    for (auto &out : h_cplx_out)
+      check_results(out, std_out, /*tol_multiplier*/ 2);
+  }
+
+  // Check cplx::complex output from host
+  apply(h_cplx_out);
+
+  for (auto &out : h_cplx_out)
+    check_results(out, std_out, /*tol_multiplier*/ 2);
+
+  sycl::free(d_cplx_out, Q);
+}
+
+TEMPLATE_TEST_CASE("Test complex pow with compile-time exponent", "[pow]",
+                   double, float, sycl::half) {
+  using T = TestType;
+  using std_T = std::conditional_t<std::is_same_v<T, sycl::half>, float, T>;
+
+  sycl::queue Q;
+
+  // Test cases
+  cmplx<T> input = GENERATE(cmplx<T>{1.25, 0.5}, cmplx<T>{-0.75, 1.125},
+                            cmplx<T>{0, -1.5}, cmplx<T>{-1, 0});
+
+  constexpr int exponents[] = {-2, 0, 1, 3, 8};
+  constexpr std::size_t N = std::size(exponents);
+
+  std::array<std::complex<T>, N> std_out;
+  for (std::size_t i = 0; i < N; ++i) {
+    auto reference = std::pow(
+        std::complex<long double>(std_T(input.re), std_T(input.im)),
+        static_cast<long double>(exponents[i]));
+    std_out[i] = init_std_complex(
+        cmplx<T>{T(std_T(reference.real())), T(std_T(reference.imag()))});
+  }
+
+  sycl::ext::cplx::complex<T> cplx_input{input.re, input.im};
+
+  auto apply = [](sycl::ext::cplx::complex<T> z) {
+    return std::array<sycl::ext::cplx::complex<T>, N>{
+        sycl::ext::cplx::pow<-2>(z), sycl::ext::cplx::pow<0>(z),
+        sycl::ext::cplx::pow<1>(z), sycl::ext::cplx::pow<3>(z),
+        sycl::ext::cplx::pow<8>(z)};
+  };
+
+  std::array<sycl::ext::cplx::complex<T>, N> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<sycl::ext::cplx::complex<T>>(N, Q);
+
+  // Check cplx::complex output from device
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       auto out = apply(cplx_input);
+       for (std::size_t i = 0; i < N; ++i)
+         d_cplx_out[i] = out[i];
+     }).wait();
+    Q.copy(d_cplx_out, h_cplx_out.data(), N).wait();
+
+    for (std::size_t i = 0; i < N; ++i)
+      check_results(h_cplx_out[i], std_out[i], /*tol_multiplier*/ 2);
+  }
+
+  // Check cplx::complex output from host
+  h_cplx_out = apply(cplx_input);
+
+  for (std::size_t i = 0; i < N; ++i)
+    check_results(h_cplx_out[i], std_out[i], /*tol_multiplier*/ 2);
+
+  sycl::free(d_cplx_out, Q);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // MARRAY<COMPLEX> TESTS
 ////////////////////////////////////////////////////////////////////////////////
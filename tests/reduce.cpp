@@ -0,0 +1,74 @@
+#include <numeric>
+#include <vector>
+
+#include "test_helper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// UTILITY FUNCTIONS
+////////////////////////////////////////////////////////////////////////////////
+
+template <typename T, typename BinaryOperation>
+void test_reduce(sycl::queue q, const std::vector<T> &input,
+                 BinaryOperation binary_op) {
+  const std::size_t N = input.size();
+
+  const auto init =
+      sycl::ext::cplx::cplex::detail::get_init<T, BinaryOperation>();
+
+  auto *d_in = sycl::malloc_device<T>(N, q);
+  q.copy(input.data(), d_in, N).wait();
+
+  const auto output_with_init =
+      sycl::ext::cplx::reduce(q, d_in, N, init, binary_op);
+  const auto output_without_init =
+      sycl::ext::cplx::reduce(q, d_in, N, binary_op);
+
+  const auto expected =
+      std::accumulate(input.begin(), input.end(), init, binary_op);
+
+  check_results(output_with_init, expected);
+  check_results(output_without_init, expected);
+
+  sycl::free(d_in, q);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPLEX TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE_SIG("Test complex reduce", "[reduction]",
+                       ((typename T, typename BinaryOperation), T,
+                        BinaryOperation),
+                       (double, sycl::plus<>), (float, sycl::plus<>),
+                       (sycl::half, sycl::plus<>),
+                       (double, sycl::multiplies<>),
+                       (float, sycl::multiplies<>),
+                       (sycl::half, sycl::multiplies<>),
+                       (float, sycl::ext::cplx::compensated_plus)) {
+
+  using Complex = typename sycl::ext::cplx::complex<T>;
+
+  sycl::queue q;
+
+  // Sizes below, at and above one work-group, and spanning many work-groups
+  const auto N = GENERATE(1, 7, 64, 1000, 4099);
+
+  // The values are chosen so that every partial sum or product is exact
+  std::vector<Complex> input(N);
+  for (std::size_t i = 0; i < input.size(); i++) {
+    if constexpr (!sycl::ext::cplx::cplex::detail::is_multiplies_v<
+                      BinaryOperation>) {
+      input[i] = Complex{T(int(i % 7) - 3), T(int(i % 5) - 2)};
+    } else {
+      const Complex cycle[] = {Complex{0, 1}, Complex{-1, 0}, Complex{0, -1},
+                               Complex{1, 0}};
+      input[i] = cycle[i % 4];
+    }
+  }
+
+  const auto binary_op = BinaryOperation{};
+
+  if (is_type_supported<T>(q)) {
+    test_reduce(q, input, binary_op);
+  }
+}
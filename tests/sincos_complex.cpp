@@ -0,0 +1,124 @@
+#include "test_helper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPLEX TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE("Test complex sincos and sinhcosh", "[sincos]", double,
+                   float, sycl::half) {
+  using T = TestType;
+  namespace cplx = sycl::ext::cplx;
+
+  sycl::queue Q;
+
+  // Test cases
+  cmplx<T> input = GENERATE(
+      cmplx<T>{4.42, 2.02}, cmplx<T>{-0.5, 0.75}, cmplx<T>{0.001, -1.5},
+      cmplx<T>{-1.25, 0}, cmplx<T>{0, 2.5}, cmplx<T>{inf_val<T>, 2.02},
+      cmplx<T>{4.42, inf_val<T>}, cmplx<T>{inf_val<T>, inf_val<T>},
+      cmplx<T>{nan_val<T>, 2.02}, cmplx<T>{4.42, nan_val<T>},
+      cmplx<T>{nan_val<T>, nan_val<T>}, cmplx<T>{nan_val<T>, inf_val<T>},
+      cmplx<T>{inf_val<T>, nan_val<T>});
+
+  auto std_in = init_std_complex(input);
+  cplx::complex<T> cplx_input{input.re, input.im};
+
+  // Get std::complex output
+  std::complex<T> std_out[4] = {std::sin(std_in), std::cos(std_in),
+                                std::sinh(std_in), std::cosh(std_in)};
+
+  cplx::complex<T> h_cplx_out[4];
+  auto d_cplx_out = sycl::malloc_device<cplx::complex<T>>(4, Q);
+
+  // Check cplx::complex output from device
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = cplx::sincos<T>(cplx_input, &d_cplx_out[1]);
+       d_cplx_out[2] = cplx::sinhcosh<T>(cplx_input, &d_cplx_out[3]);
+     }).wait();
+    Q.copy(d_cplx_out, h_cplx_out, 4).wait();
+
+    for (int i = 0; i < 4; ++i)
+      check_results(h_cplx_out[i], std_out[i]);
+  }
+
+  // Check cplx::complex output from host
+  h_cplx_out[0] = cplx::sincos<T>(cplx_input, &h_cplx_out[1]);
+  h_cplx_out[2] = cplx::sinhcosh<T>(cplx_input, &h_cplx_out[3]);
+
+  for (int i = 0; i < 4; ++i)
+    check_results(h_cplx_out[i], std_out[i]);
+
+  sycl::free(d_cplx_out, Q);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// MARRAY<COMPLEX> TESTS
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE_SIG("Test marray complex sincos and sinhcosh", "[sincos]",
+                       ((typename T, std::size_t NumElements), T, NumElements),
+                       (double, 14), (float, 14), (sycl::half, 14)) {
+  namespace cplx = sycl::ext::cplx;
+
+  sycl::queue Q;
+
+  // std::complex test cases
+  const auto std_in =
+      GENERATE(init_std_complex(sycl::marray<std::complex<T>, NumElements>{
+          std::complex<T>{1.0, 1.0},
+          std::complex<T>{4.42, 2.02},
+          std::complex<T>{-3, 3.5},
+          std::complex<T>{4.0, -4.0},
+          std::complex<T>{2.02, inf_val<T>},
+          std::complex<T>{inf_val<T>, 4.42},
+          std::complex<T>{inf_val<T>, nan_val<T>},
+          std::complex<T>{2.02, 4.42},
+          std::complex<T>{nan_val<T>, nan_val<T>},
+          std::complex<T>{nan_val<T>, nan_val<T>},
+          std::complex<T>{inf_val<T>, inf_val<T>},
+          std::complex<T>{nan_val<T>, nan_val<T>},
+          std::complex<T>{inf_val<T>, inf_val<T>},
+          std::complex<T>{nan_val<T>, nan_val<T>},
+      }));
+
+  // sycl::complex test cases
+  sycl::marray<cplx::complex<T>, NumElements> cplx_input;
+  for (std::size_t i = 0; i < NumElements; ++i) {
+    cplx_input[i] = cplx::complex<T>{std_in[i].real(), std_in[i].imag()};
+  }
+
+  sycl::marray<std::complex<T>, NumElements> std_out[4]{};
+  sycl::marray<cplx::complex<T>, NumElements> h_cplx_out[4];
+  auto d_cplx_out =
+      sycl::malloc_device<sycl::marray<cplx::complex<T>, NumElements>>(4, Q);
+
+  // Get std::complex output
+  for (std::size_t i = 0; i < NumElements; ++i) {
+    std_out[0][i] = std::sin(std_in[i]);
+    std_out[1][i] = std::cos(std_in[i]);
+    std_out[2][i] = std::sinh(std_in[i]);
+    std_out[3][i] = std::cosh(std_in[i]);
+  }
+
+  // Check cplx::complex output from device
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = cplx::sincos<T>(cplx_input, &d_cplx_out[1]);
+       d_cplx_out[2] = cplx::sinhcosh<T>(cplx_input, &d_cplx_out[3]);
+     }).wait();
+    Q.copy(d_cplx_out, h_cplx_out, 4).wait();
+
+    for (int i = 0; i < 4; ++i)
+      check_results(h_cplx_out[i], std_out[i]);
+  }
+
+  // Check cplx::complex output from host
+  h_cplx_out[0] = cplx::sincos<T>(cplx_input, &h_cplx_out[1]);
+  h_cplx_out[2] = cplx::sinhcosh<T>(cplx_input, &h_cplx_out[3]);
+
+  for (int i = 0; i < 4; ++i)
+    check_results(h_cplx_out[i], std_out[i]);
+
+  sycl::free(d_cplx_out, Q);
+}
@@ -45,6 +45,66 @@ TEMPLATE_TEST_CASE("Test complex sqrt", "[sqrt]", double, float, sycl::half) {
   sycl::free(d_cplx_out, Q);
 }
 
+TEMPLATE_TEST_CASE("Test complex sqrt accuracy", "[sqrt]", double, float,
+                   sycl::half) {
+  using T = TestType;
+  using std_T = std::conditional_t<std::is_same_v<T, sycl::half>, float, T>;
+
+  sycl::queue Q;
+
+  // Operands at the ends of the range of T, where |z| overflows or underflows,
+  // and next to the negative real axis, where the smaller part of the result
+  // is a tiny fraction of the larger one
+  const int e = std::is_same_v<T, double>  ? 1023
+                : std::is_same_v<T, float> ? 127
+                                           : 15;
+  const int m = std::is_same_v<T, double>  ? 1024
+                : std::is_same_v<T, float> ? 128
+                                           : 16;
+  const int t = std::is_same_v<T, double>  ? -40
+                : std::is_same_v<T, float> ? -20
+                                           : -8;
+  const int exponents[][2] = {{e, e},  {e, 0},  {-m, -m},   {0, -m},
+                              {0, t},  {-m, e}, {-3, t - 3}};
+  const auto *exponent = exponents[GENERATE(0, 1, 2, 3, 4, 5, 6)];
+  const auto signs = GENERATE(cmplx<T>{1, 1}, cmplx<T>{-1, 1},
+                              cmplx<T>{-1, -1}, cmplx<T>{1, -1});
+
+  cmplx<T> input{T(std_T(std::ldexp(std_T(signs.re) * 1.5, exponent[0]))),
+                 T(std_T(std::ldexp(std_T(signs.im) * 1.25, exponent[1])))};
+
+  // Reference in extended precision and range
+  auto reference = std::sqrt(
+      std::complex<long double>(std_T(input.re), std_T(input.im)));
+  std::complex<T> std_out = init_std_complex(
+      cmplx<T>{T(std_T(reference.real())), T(std_T(reference.imag()))});
+
+  sycl::ext::cplx::complex<T> cplx_input{input.re, input.im};
+
+  sycl::ext::cplx::complex<T> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<sycl::ext::cplx::complex<T>>(1, Q);
+
+  // Check cplx::complex output from device, per part as the smaller part can
+  // be tiny compared with the larger one
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = sycl::ext::cplx::sqrt<T>(cplx_input);
+     }).wait();
+    Q.copy(d_cplx_out, &h_cplx_out, 1).wait();
+
+    check_results(h_cplx_out.real(), std_out.real());
+    check_results(h_cplx_out.imag(), std_out.imag());
+  }
+
+  // Check cplx::complex output from host
+  h_cplx_out = sycl::ext::cplx::sqrt<T>(cplx_input);
+
+  check_results(h_cplx_out.real(), std_out.real());
+  check_results(h_cplx_out.imag(), std_out.imag());
+
+  sycl::free(d_cplx_out, Q);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // MARRAY<COMPLEX> TESTS
 ////////////////////////////////////////////////////////////////////////////////
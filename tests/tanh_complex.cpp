@@ -45,6 +45,44 @@ TEMPLATE_TEST_CASE("Test complex tanh", "[tanh]", double, float, sycl::half) {
   sycl::free(d_cplx_out, Q);
 }
 
+TEMPLATE_TEST_CASE("Test complex tanh accuracy", "[tanh]", double, float,
+                   sycl::half) {
+  using T = TestType;
+  using std_T = std::conditional_t<std::is_same_v<T, sycl::half>, float, T>;
+
+  sycl::queue Q;
+
+  // Small and large real parts, and imaginary parts near the poles of tan
+  cmplx<T> input = GENERATE(cmplx<T>{0.001, 1.5}, cmplx<T>{-2.5, 0.75},
+                            cmplx<T>{0.25, -1.5625}, cmplx<T>{5.5, -1},
+                            cmplx<T>{-0.0625, 3.125});
+
+  std::complex<long double> ref =
+      std::tanh(std::complex<long double>(std_T(input.re), std_T(input.im)));
+  std::complex<T> std_out{T(std_T(ref.real())), T(std_T(ref.imag()))};
+
+  sycl::ext::cplx::complex<T> cplx_input{input.re, input.im};
+
+  sycl::ext::cplx::complex<T> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<sycl::ext::cplx::complex<T>>(1, Q);
+
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = sycl::ext::cplx::tanh(cplx_input);
+     }).wait();
+    Q.copy(d_cplx_out, &h_cplx_out, 1).wait();
+    check_results(h_cplx_out.real(), std_out.real());
+    check_results(h_cplx_out.imag(), std_out.imag());
+  }
+
+  h_cplx_out = sycl::ext::cplx::tanh(cplx_input);
+
+  check_results(h_cplx_out.real(), std_out.real());
+  check_results(h_cplx_out.imag(), std_out.imag());
+
+  sycl::free(d_cplx_out, Q);
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 // MARRAY<COMPLEX> TESTS
 ////////////////////////////////////////////////////////////////////////////////
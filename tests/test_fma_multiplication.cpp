@@ -0,0 +1,52 @@
+#define _SYCL_EXT_CPLX_FMA_MULTIPLICATION
+#include "test_helper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPLEX TESTS with the fma multiplication
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE("Test complex fma multiplication", "[mul]", double, float) {
+  using T = TestType;
+  namespace cplx = sycl::ext::cplx;
+
+  sycl::queue Q;
+
+  cmplx<T> input1 = GENERATE(cmplx<T>{4.42, 2.02}, cmplx<T>{-1.3, 0.7},
+                             cmplx<T>{0.1, -3.3});
+  cmplx<T> input2 = GENERATE(cmplx<T>{1.9, -0.3}, cmplx<T>{-2.7, 5.1},
+                             cmplx<T>{-1.3, -0.7});
+
+  // Each part is a single fma over one rounded product, whatever the policy
+  const T a = input1.re, b = input1.im, c = input2.re, d = input2.im;
+  const T expected_re = std::fma(a, c, -(b * d));
+  const T expected_im = std::fma(a, d, b * c);
+
+  cplx::complex<T> cplx_input1{input1.re, input1.im};
+  cplx::complex<T> cplx_input2{input2.re, input2.im};
+
+  auto check_policy = [&](auto policy) {
+    using Policy = decltype(policy);
+
+    cplx::complex<T> h_cplx_out;
+    auto d_cplx_out = sycl::malloc_device<cplx::complex<T>>(1, Q);
+
+    if (is_type_supported<T>(Q)) {
+      Q.single_task([=]() {
+         d_cplx_out[0] = cplx::multiply(cplx_input1, cplx_input2, Policy{});
+       }).wait();
+      Q.copy(d_cplx_out, &h_cplx_out, 1).wait();
+      check_results(h_cplx_out.real(), expected_re);
+      check_results(h_cplx_out.imag(), expected_im);
+    }
+
+    h_cplx_out = cplx::multiply(cplx_input1, cplx_input2, Policy{});
+    CHECK(h_cplx_out.real() == expected_re);
+    CHECK(h_cplx_out.imag() == expected_im);
+
+    sycl::free(d_cplx_out, Q);
+  };
+
+  check_policy(cplx::ieee{});
+  check_policy(cplx::finite_only{});
+  check_policy(cplx::fast{});
+}
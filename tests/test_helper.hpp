@@ -238,6 +238,35 @@ void check_results(std::array<T, NumElements> output,
   }
 }
 
+/// Checks that the parts which are exactly zero in the reference are exactly
+/// zero in the output, as in the products of real or imaginary values
+template <typename T>
+typename std::enable_if_t<detail::is_a_complex_v<T>, void>
+check_zero_parts(T output, T reference) {
+  if (reference.real() == 0)
+    CHECK(output.real() == 0);
+  if (reference.imag() == 0)
+    CHECK(output.imag() == 0);
+}
+
+/// Specialization for sycl::marray
+template <typename T, std::size_t NumElements>
+void check_zero_parts(sycl::marray<T, NumElements> output,
+                      sycl::marray<T, NumElements> reference) {
+  for (std::size_t i = 0; i < NumElements; ++i) {
+    check_zero_parts(output[i], reference[i]);
+  }
+}
+
+/// Specialization for std::array
+template <typename T, std::size_t NumElements>
+void check_zero_parts(std::array<T, NumElements> output,
+                      std::array<T, NumElements> reference) {
+  for (std::size_t i = 0; i < NumElements; ++i) {
+    check_zero_parts(output[i], reference[i]);
+  }
+}
+
 template <typename T>
 struct ComplexMatcher : Catch::Matchers::MatcherGenericBase {
   using FpType = decltype((T{}).real());
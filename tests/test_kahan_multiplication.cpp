@@ -0,0 +1,59 @@
+#define _SYCL_EXT_CPLX_KAHAN_MULTIPLICATION
+#include "test_helper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPLEX TESTS with the Kahan multiplication
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE("Test complex Kahan multiplication", "[mul]", double, float,
+                   sycl::half) {
+  using T = TestType;
+  using std_T = std::conditional_t<std::is_same_v<T, sycl::half>, float, T>;
+
+  sycl::queue Q;
+
+  // p = 1 + 2^-k and q = 1 + 2^-(k+1) have exact squares and products in long
+  // double but not in T, so that p p - q q and p q - q p cancel the rounding
+  // errors of the naive and of the single fma products
+  const int k = std::is_same_v<T, double>  ? 30
+                : std::is_same_v<T, float> ? 13
+                                           : 6;
+  const T p = T(std_T(1 + std::ldexp(1.0, -k)));
+  const T q = T(std_T(1 + std::ldexp(1.0, -k - 1)));
+
+  cmplx<T> input1 = GENERATE_COPY(cmplx<T>{p, q}, cmplx<T>{q, p},
+                                  cmplx<T>{-p, q}, cmplx<T>{p, -q});
+  cmplx<T> input2 = GENERATE_COPY(cmplx<T>{p, q}, cmplx<T>{q, -p},
+                                  cmplx<T>{-q, p}, cmplx<T>{p, p});
+
+  // Reference in extended precision, exact for these operands
+  auto reference = std::complex<long double>(std_T(input1.re),
+                                             std_T(input1.im)) *
+                   std::complex<long double>(std_T(input2.re),
+                                             std_T(input2.im));
+  std::complex<T> std_out = init_std_complex(
+      cmplx<T>{T(std_T(reference.real())), T(std_T(reference.imag()))});
+
+  sycl::ext::cplx::complex<T> cplx_input1{input1.re, input1.im};
+  sycl::ext::cplx::complex<T> cplx_input2{input2.re, input2.im};
+
+  sycl::ext::cplx::complex<T> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<sycl::ext::cplx::complex<T>>(1, Q);
+
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = cplx_input1 * cplx_input2;
+     }).wait();
+    Q.copy(d_cplx_out, &h_cplx_out, 1).wait();
+    check_results(h_cplx_out.real(), std_out.real());
+    check_results(h_cplx_out.imag(), std_out.imag());
+  }
+
+  h_cplx_out = cplx_input1 * cplx_input2;
+
+  // Checked per part, the error of the cancelling part is relative to it alone
+  check_results(h_cplx_out.real(), std_out.real());
+  check_results(h_cplx_out.imag(), std_out.imag());
+
+  sycl::free(d_cplx_out, Q);
+}
@@ -0,0 +1,273 @@
+#include "test_helper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPLEX TESTS with an explicit accuracy policy
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE("Test complex multiply and divide policies", "[policy]",
+                   double, float, sycl::half) {
+  using T = TestType;
+  namespace cplx = sycl::ext::cplx;
+
+  sycl::queue Q;
+
+  cmplx<T> input1 = GENERATE(cmplx<T>{4.42, 2.02}, cmplx<T>{-1.25, 1.75},
+                             cmplx<T>{0, 1.5}, cmplx<T>{-3.5, -0.5});
+  cmplx<T> input2 = GENERATE(cmplx<T>{1.75, -1.5}, cmplx<T>{0.625, 1.25},
+                             cmplx<T>{-1.5, 0});
+
+  auto std_in1 = init_std_complex(input1);
+  auto std_in2 = init_std_complex(input2);
+  cplx::complex<T> cplx_input1{input1.re, input1.im};
+  cplx::complex<T> cplx_input2{input2.re, input2.im};
+
+  std::complex<T> std_mul = std_in1 * std_in2;
+  std::complex<T> std_div = std_in1 / std_in2;
+
+  auto check_policy = [&](auto policy) {
+    using Policy = decltype(policy);
+
+    cplx::complex<T> h_cplx_out[2];
+    auto d_cplx_out = sycl::malloc_device<cplx::complex<T>>(2, Q);
+
+    if (is_type_supported<T>(Q)) {
+      Q.single_task([=]() {
+         d_cplx_out[0] = cplx::multiply(cplx_input1, cplx_input2, Policy{});
+         d_cplx_out[1] = cplx::divide(cplx_input1, cplx_input2, Policy{});
+       }).wait();
+      Q.copy(d_cplx_out, h_cplx_out, 2).wait();
+      check_results(h_cplx_out[0], std_mul);
+      check_results(h_cplx_out[1], std_div);
+    }
+
+    h_cplx_out[0] = cplx::multiply(cplx_input1, cplx_input2, Policy{});
+    h_cplx_out[1] = cplx::divide(cplx_input1, cplx_input2, Policy{});
+    check_results(h_cplx_out[0], std_mul);
+    check_results(h_cplx_out[1], std_div);
+
+    sycl::free(d_cplx_out, Q);
+  };
+
+  check_policy(cplx::ieee{});
+  check_policy(cplx::finite_only{});
+  check_policy(cplx::fast{});
+}
+
+// The fma product rounds one of the two products of each part only, so it
+// keeps neither symmetry
+#if !defined(_SYCL_EXT_CPLX_FMA_MULTIPLICATION)
+TEMPLATE_TEST_CASE("Test complex multiply symmetry", "[policy]", double,
+                   float, sycl::half) {
+  using T = TestType;
+  namespace cplx = sycl::ext::cplx;
+
+  sycl::queue Q;
+
+  // Products whose parts are all inexact: conj(z) z must be exactly real and
+  // z w must equal w z bit for bit, whatever the policy
+  cmplx<T> input1 = GENERATE(cmplx<T>{4.42, 2.02}, cmplx<T>{-1.3, 0.7},
+                             cmplx<T>{0.1, -3.3});
+  cmplx<T> input2 = GENERATE(cmplx<T>{1.9, -0.3}, cmplx<T>{-2.7, 5.1});
+
+  cplx::complex<T> cplx_input1{input1.re, input1.im};
+  cplx::complex<T> cplx_input2{input2.re, input2.im};
+
+  auto check_policy = [&](auto policy) {
+    using Policy = decltype(policy);
+
+    auto apply = [](cplx::complex<T> z, cplx::complex<T> w) {
+      return std::array<cplx::complex<T>, 3>{
+          cplx::multiply(cplx::conj(z), z, Policy{}),
+          cplx::multiply(z, w, Policy{}), cplx::multiply(w, z, Policy{})};
+    };
+    auto check = [](const std::array<cplx::complex<T>, 3> &out) {
+      CHECK(out[0].imag() == T(0));
+      CHECK(out[1].real() == out[2].real());
+      CHECK(out[1].imag() == out[2].imag());
+    };
+
+    std::array<cplx::complex<T>, 3> h_cplx_out;
+    auto d_cplx_out = sycl::malloc_device<cplx::complex<T>>(3, Q);
+
+    if (is_type_supported<T>(Q)) {
+      Q.single_task([=]() {
+         auto out = apply(cplx_input1, cplx_input2);
+         for (std::size_t i = 0; i < 3; ++i)
+           d_cplx_out[i] = out[i];
+       }).wait();
+      Q.copy(d_cplx_out, h_cplx_out.data(), 3).wait();
+      check(h_cplx_out);
+    }
+
+    h_cplx_out = apply(cplx_input1, cplx_input2);
+    check(h_cplx_out);
+    CHECK(cplx::imag(cplx::conj(cplx_input1) * cplx_input1) == T(0));
+
+    sycl::free(d_cplx_out, Q);
+  };
+
+  check_policy(cplx::ieee{});
+  check_policy(cplx::finite_only{});
+  check_policy(cplx::fast{});
+}
+#endif
+
+TEMPLATE_TEST_CASE("Test complex ieee policy with special values", "[policy]",
+                   double, float, sycl::half) {
+  using T = TestType;
+  namespace cplx = sycl::ext::cplx;
+
+  sycl::queue Q;
+
+  cmplx<T> input1 = GENERATE(
+      cmplx<T>{4.42, 2.02}, cmplx<T>{inf_val<T>, 2.02},
+      cmplx<T>{4.42, inf_val<T>}, cmplx<T>{inf_val<T>, inf_val<T>},
+      cmplx<T>{nan_val<T>, 2.02}, cmplx<T>{4.42, nan_val<T>},
+      cmplx<T>{nan_val<T>, nan_val<T>}, cmplx<T>{nan_val<T>, inf_val<T>},
+      cmplx<T>{inf_val<T>, nan_val<T>});
+  cmplx<T> input2 =
+      GENERATE(cmplx<T>{4.42, 2.02}, cmplx<T>{0, 0}, cmplx<T>{inf_val<T>, 2.02},
+               cmplx<T>{4.42, inf_val<T>}, cmplx<T>{nan_val<T>, 2.02});
+
+  auto std_in1 = init_std_complex(input1);
+  auto std_in2 = init_std_complex(input2);
+  cplx::complex<T> cplx_input1{input1.re, input1.im};
+  cplx::complex<T> cplx_input2{input2.re, input2.im};
+
+  std::complex<T> std_mul = std_in1 * std_in2;
+  std::complex<T> std_div = std_in1 / std_in2;
+
+  cplx::complex<T> h_cplx_out[2];
+  auto d_cplx_out = sycl::malloc_device<cplx::complex<T>>(2, Q);
+
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = cplx::multiply(cplx_input1, cplx_input2, cplx::ieee{});
+       d_cplx_out[1] = cplx::divide(cplx_input1, cplx_input2, cplx::ieee{});
+     }).wait();
+    Q.copy(d_cplx_out, h_cplx_out, 2).wait();
+    check_results(h_cplx_out[0], std_mul);
+    check_results(h_cplx_out[1], std_div);
+  }
+
+  h_cplx_out[0] = cplx::multiply(cplx_input1, cplx_input2, cplx::ieee{});
+  h_cplx_out[1] = cplx::divide(cplx_input1, cplx_input2, cplx::ieee{});
+  check_results(h_cplx_out[0], std_mul);
+  check_results(h_cplx_out[1], std_div);
+
+  sycl::free(d_cplx_out, Q);
+}
+
+TEMPLATE_TEST_CASE("Test complex functions with a policy", "[policy]", double,
+                   float, sycl::half) {
+  using T = TestType;
+  namespace cplx = sycl::ext::cplx;
+
+  sycl::queue Q;
+
+  cmplx<T> input = GENERATE(cmplx<T>{0.42, 0.75}, cmplx<T>{-1.25, 0.5},
+                            cmplx<T>{2.5, -1.5}, cmplx<T>{-0.5, -0.25});
+
+  auto std_in = init_std_complex(input);
+  cplx::complex<T> cplx_input{input.re, input.im};
+
+  constexpr std::size_t N = 6;
+  std::array<std::complex<T>, N> std_out{
+      std::exp(std_in),  std::log(std_in),  std::sqrt(std_in),
+      std::sin(std_in),  std::tanh(std_in), std::atanh(std_in)};
+
+  auto check_policy = [&](auto policy) {
+    using Policy = decltype(policy);
+
+    auto apply = [](cplx::complex<T> z) {
+      return std::array<cplx::complex<T>, N>{
+          cplx::exp(z, Policy{}),  cplx::log(z, Policy{}),
+          cplx::sqrt(z, Policy{}), cplx::sin(z, Policy{}),
+          cplx::tanh(z, Policy{}), cplx::atanh(z, Policy{})};
+    };
+
+    std::array<cplx::complex<T>, N> h_cplx_out;
+    auto d_cplx_out = sycl::malloc_device<cplx::complex<T>>(N, Q);
+
+    if (is_type_supported<T>(Q)) {
+      Q.single_task([=]() {
+         auto out = apply(cplx_input);
+         for (std::size_t i = 0; i < N; ++i)
+           d_cplx_out[i] = out[i];
+       }).wait();
+      Q.copy(d_cplx_out, h_cplx_out.data(), N).wait();
+      for (std::size_t i = 0; i < N; ++i)
+        check_results(h_cplx_out[i], std_out[i], /*tol_multiplier*/ 2);
+    }
+
+    h_cplx_out = apply(cplx_input);
+    for (std::size_t i = 0; i < N; ++i)
+      check_results(h_cplx_out[i], std_out[i], /*tol_multiplier*/ 2);
+
+    sycl::free(d_cplx_out, Q);
+  };
+
+  check_policy(cplx::ieee{});
+  check_policy(cplx::finite_only{});
+  check_policy(cplx::fast{});
+}
+
+TEMPLATE_TEST_CASE("Test complex_fast", "[policy]", double, float,
+                   sycl::half) {
+  using T = TestType;
+  namespace cplx = sycl::ext::cplx;
+
+  static_assert(std::is_same_v<decltype(std::declval<cplx::complex_fast<T>>() *
+                                        std::declval<cplx::complex_fast<T>>()),
+                               cplx::complex_fast<T>>);
+  static_assert(std::is_same_v<decltype(std::declval<cplx::complex_fast<T>>() /
+                                        std::declval<T>()),
+                               cplx::complex_fast<T>>);
+  static_assert(std::is_same_v<decltype(cplx::exp(
+                                   std::declval<cplx::complex_fast<T>>())),
+                               cplx::complex_fast<T>>);
+
+  sycl::queue Q;
+
+  cmplx<T> input1 = GENERATE(cmplx<T>{4.42, 2.02}, cmplx<T>{-1.25, 1.75},
+                             cmplx<T>{0, 1.5});
+  cmplx<T> input2 = GENERATE(cmplx<T>{1.75, -1.5}, cmplx<T>{0.625, 1.25},
+                             cmplx<T>{-1.5, 0});
+
+  auto std_in1 = init_std_complex(input1);
+  auto std_in2 = init_std_complex(input2);
+  cplx::complex_fast<T> cplx_input1{input1.re, input1.im};
+  cplx::complex_fast<T> cplx_input2{input2.re, input2.im};
+
+  constexpr std::size_t N = 5;
+  std::array<std::complex<T>, N> std_out{
+      std_in1 + std_in2, std_in1 - std_in2, std_in1 * std_in2,
+      std_in1 / std_in2, std::exp(std_in1 / std_in2)};
+
+  auto apply = [](cplx::complex_fast<T> z, cplx::complex_fast<T> w) {
+    cplx::complex_fast<T> q = z;
+    q /= w;
+    return std::array<cplx::complex<T>, N>{z + w, z - w, z * w, z / w,
+                                           cplx::exp(q)};
+  };
+
+  std::array<cplx::complex<T>, N> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<cplx::complex<T>>(N, Q);
+
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       auto out = apply(cplx_input1, cplx_input2);
+       for (std::size_t i = 0; i < N; ++i)
+         d_cplx_out[i] = out[i];
+     }).wait();
+    Q.copy(d_cplx_out, h_cplx_out.data(), N).wait();
+    for (std::size_t i = 0; i < N; ++i)
+      check_results(h_cplx_out[i], std_out[i], /*tol_multiplier*/ 2);
+  }
+
+  h_cplx_out = apply(cplx_input1, cplx_input2);
+  for (std::size_t i = 0; i < N; ++i)
+    check_results(h_cplx_out[i], std_out[i], /*tol_multiplier*/ 2);
+
+  sycl::free(d_cplx_out, Q);
+}
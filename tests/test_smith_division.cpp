@@ -0,0 +1,106 @@
+#define _SYCL_EXT_CPLX_SMITH_DIVISION
+#include "test_helper.hpp"
+
+////////////////////////////////////////////////////////////////////////////////
+// COMPLEX TESTS with the Smith division
+////////////////////////////////////////////////////////////////////////////////
+
+TEMPLATE_TEST_CASE("Test complex Smith division", "[div]", double, float,
+                   sycl::half) {
+  using T = TestType;
+  using std_T = std::conditional_t<std::is_same_v<T, sycl::half>, float, T>;
+
+  sycl::queue Q;
+
+  // Exponents of the real and imaginary parts of both operands, chosen so
+  // that the naive products overflow or underflow T
+  const int e = std::is_same_v<T, double>  ? 900
+                : std::is_same_v<T, float> ? 110
+                                           : 12;
+  const int exponents[][4] = {{0, 0, 0, 0},    {e, e, 0, 0},   {0, 0, e, e},
+                              {-e, -e, 0, 0},  {0, 0, -e, -e}, {e, -e, e, -e},
+                              {e, -e, -e, e},  {0, 0, e, -e},  {0, 0, -e, e},
+                              {-e, e, e, e}};
+  const auto *exponent = exponents[GENERATE(0, 1, 2, 3, 4, 5, 6, 7, 8, 9)];
+
+  cmplx<T> input1 = GENERATE(cmplx<T>{1.5, 0.75}, cmplx<T>{-1.25, 1.75},
+                             cmplx<T>{0, 1.5});
+  cmplx<T> input2 = GENERATE(cmplx<T>{1.75, -1.5}, cmplx<T>{0.625, 1.25},
+                             cmplx<T>{-1.5, 0});
+
+  auto scale = [](T x, int exponent) {
+    return T(std::ldexp(std_T(x), exponent));
+  };
+  input1 = {scale(input1.re, exponent[0]), scale(input1.im, exponent[1])};
+  input2 = {scale(input2.re, exponent[2]), scale(input2.im, exponent[3])};
+
+  // Reference in extended precision and range
+  auto reference = std::complex<long double>(std_T(input1.re),
+                                             std_T(input1.im)) /
+                   std::complex<long double>(std_T(input2.re),
+                                             std_T(input2.im));
+  std::complex<T> std_out = init_std_complex(
+      cmplx<T>{T(std_T(reference.real())), T(std_T(reference.imag()))});
+
+  sycl::ext::cplx::complex<T> cplx_input1{input1.re, input1.im};
+  sycl::ext::cplx::complex<T> cplx_input2{input2.re, input2.im};
+
+  sycl::ext::cplx::complex<T> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<sycl::ext::cplx::complex<T>>(1, Q);
+
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = cplx_input1 / cplx_input2;
+     }).wait();
+    Q.copy(d_cplx_out, &h_cplx_out, 1).wait();
+    check_results(h_cplx_out, std_out);
+  }
+
+  h_cplx_out = cplx_input1 / cplx_input2;
+
+  check_results(h_cplx_out, std_out);
+
+  sycl::free(d_cplx_out, Q);
+}
+
+TEMPLATE_TEST_CASE("Test complex Smith division with special values", "[div]",
+                   double, float, sycl::half) {
+  using T = TestType;
+
+  sycl::queue Q;
+
+  cmplx<T> input1 = GENERATE(
+      cmplx<T>{4.42, 2.02}, cmplx<T>{inf_val<T>, 2.02},
+      cmplx<T>{4.42, inf_val<T>}, cmplx<T>{inf_val<T>, inf_val<T>},
+      cmplx<T>{nan_val<T>, 2.02}, cmplx<T>{4.42, nan_val<T>},
+      cmplx<T>{nan_val<T>, nan_val<T>}, cmplx<T>{nan_val<T>, inf_val<T>},
+      cmplx<T>{inf_val<T>, nan_val<T>});
+
+  cmplx<T> input2 =
+      GENERATE(cmplx<T>{4.42, 2.02}, cmplx<T>{0, 0}, cmplx<T>{inf_val<T>, 2.02},
+               cmplx<T>{4.42, inf_val<T>}, cmplx<T>{nan_val<T>, 2.02});
+
+  auto std_in1 = init_std_complex(input1);
+  auto std_in2 = init_std_complex(input2);
+  sycl::ext::cplx::complex<T> cplx_input1{input1.re, input1.im};
+  sycl::ext::cplx::complex<T> cplx_input2{input2.re, input2.im};
+
+  std::complex<T> std_out = std_in1 / std_in2;
+
+  sycl::ext::cplx::complex<T> h_cplx_out;
+  auto d_cplx_out = sycl::malloc_device<sycl::ext::cplx::complex<T>>(1, Q);
+
+  if (is_type_supported<T>(Q)) {
+    Q.single_task([=]() {
+       d_cplx_out[0] = cplx_input1 / cplx_input2;
+     }).wait();
+    Q.copy(d_cplx_out, &h_cplx_out, 1).wait();
+    check_results(h_cplx_out, std_out);
+  }
+
+  h_cplx_out = cplx_input1 / cplx_input2;
+
+  check_results(h_cplx_out, std_out);
+
+  sycl::free(d_cplx_out, Q);
+}